@@ -1,7 +1,12 @@
 #pragma once
 
+#include <vector>
 #include <cstdint>
+#include <cstring>
+#include <utility>
+#include <algorithm>
 #include <string_view>
+#include <type_traits>
 
 #include "..\Utilities\MemoryTools.hpp"
 #include "..\Utilities\BasicLogger.hpp"
@@ -65,6 +70,14 @@ namespace Globals
 	address playerPerpVehicle    = 0x0;
 	bool    playerHeatLevelKnown = false;
 
+	// Active pursuits (only maintained while "PursuitObserver" tracks pursuits; else walk "ModContainers::PursuitList")
+	bool pursuitsTracked = false;
+
+	RELEASE_CONSTINIT std::vector<std::pair<address, address>> trackedPursuits; // pursuit, local player (0x0 until resolved)
+
+	// Vehicle-type classes (sorted by type; vault data never changes, so each type is only looked up once)
+	RELEASE_CONSTINIT std::vector<std::pair<vault, vault>> vehicleTypeToClass;
+
 	// Logging (e.g. for debugging)
 	constexpr bool loggingEnabled = false;
 	BasicLogger::Logger<9, 15, 17> logger;
@@ -109,6 +122,17 @@ namespace Globals
 			return (static_cast<vault>(static_cast<unsigned char>(input[i])) << n);
 		};
 
+		const auto Load = [&input, &Shift](const size_t i) -> vault
+		{
+			if (std::is_constant_evaluated())
+				return Shift(i, 0) + Shift(i + 1, 8) + Shift(i + 2, 16) + Shift(i + 3, 24);
+
+			vault word; // x86 is little-endian, so this matches the byte-wise sum above
+			std::memcpy(&word, input.data() + i, sizeof(word));
+
+			return word;
+		};
+
 		const auto MixValues = [&a, &b, &c]() -> void
 		{
 			a -= b; a -= c; a ^= (c >> 13);
@@ -126,9 +150,9 @@ namespace Globals
 
 		while (input.size() >= 12)
 		{
-			a += Shift(0, 0) + Shift(1, 8) + Shift( 2, 16) + Shift( 3, 24);
-			b += Shift(4, 0) + Shift(5, 8) + Shift( 6, 16) + Shift( 7, 24);
-			c += Shift(8, 0) + Shift(9, 8) + Shift(10, 16) + Shift(11, 24);
+			a += Load(0);
+			b += Load(4);
+			c += Load(8);
 
 			MixValues();
 
@@ -252,8 +276,17 @@ namespace Globals
 
 	[[nodiscard]] vault GetClassOfVehicleType(const vault type)
 	{
+		const auto IsLess    = [](const std::pair<vault, vault>& pair, const vault type) -> bool {return (pair.first < type);};
+		const auto foundPair = std::lower_bound(vehicleTypeToClass.begin(), vehicleTypeToClass.end(), type, IsLess);
+
+		if ((foundPair != vehicleTypeToClass.end()) and (foundPair->first == type)) return foundPair->second;
+
 		const address attribute = GetFromVault("pvehicle"_vlt, type, "CLASS"_vlt);
-		return (attribute) ? AsReference<vault>(attribute + 0x8) : ""_vlt;
+		const vault   typeClass = (attribute) ? AsReference<vault>(attribute + 0x8) : ""_vlt;
+
+		vehicleTypeToClass.emplace(foundPair, type, typeClass); // also caches unknown types
+
+		return typeClass;
 	}
 
 
@@ -0,0 +1,194 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include "Globals.hpp"
+
+
+
+namespace LookupCaches
+{
+	// Parameters -----------------------------------------------------------------------------------------------------------------------------------
+
+	// Logging
+	constexpr LogLiteral logTag = "[LKP]";
+
+
+
+
+
+	// TickMemo class -------------------------------------------------------------------------------------------------------------------------------
+
+	// Direct-mapped memo of game lookups; entries expire when the game tick advances
+	template <typename V, size_t numSlots>
+	class TickMemo
+	{
+	private: // types
+
+		struct Slot
+		{
+		// Members
+
+			address  object = 0x0;
+			vault    key    = 0x0;
+			uint32_t tick   = 0;
+			V        value  = {};
+		};
+
+
+	private: // members
+
+		std::array<Slot, numSlots> slots = {};
+
+		uint32_t numHits   = 0; // logging only
+		uint32_t numMisses = 0; // logging only
+
+
+	private: // methods
+
+		[[nodiscard]] static size_t GetSlotID
+		(
+			const address object,
+			const vault   key
+		) {
+			return ((object >> 4) ^ key) % numSlots; // game objects are at least 16-byte aligned
+		}
+
+
+	public: // methods
+
+		template <typename Lookup>
+		[[nodiscard]] V GetValue
+		(
+			const address object,
+			const vault   key,
+			Lookup&&      lookup
+		) {
+			if (not object) return lookup(); // never cached
+
+			Slot&          slot        = this->slots[this->GetSlotID(object, key)];
+			const uint32_t currentTick = Globals::numGameTicks;
+
+			if ((slot.object == object) and (slot.key == key) and (slot.tick == currentTick))
+			{
+				if constexpr (Globals::loggingEnabled)
+					++(this->numHits);
+
+				return slot.value;
+			}
+
+			if constexpr (Globals::loggingEnabled)
+				++(this->numMisses);
+
+			slot = {object, key, currentTick, lookup()};
+
+			return slot.value;
+		}
+
+
+		void Forget(const address object)
+		{
+			for (Slot& slot : this->slots)
+			{
+				if (slot.object == object)
+					slot.object = 0x0;
+			}
+		}
+
+
+		void Clear()
+		{
+			for (Slot& slot : this->slots)
+				slot.object = 0x0;
+		}
+
+
+		void Log(const char* const name)
+		{
+			if (this->numHits + this->numMisses == 0) return;
+
+			Globals::LogPlain(name, LogDec(this->numHits), "hit(s),", LogDec(this->numMisses), "miss(es)");
+
+			this->numHits   = 0;
+			this->numMisses = 0;
+		}
+	};
+
+
+
+
+
+	// Parameters (cont.) ---------------------------------------------------------------------------------------------------------------------------
+
+	// Code caves
+	RELEASE_CONSTINIT TickMemo<vault,   64> vehicleTypes;
+	RELEASE_CONSTINIT TickMemo<address, 16> pursuitAttributes;
+
+
+
+
+
+	// Lookup functions -----------------------------------------------------------------------------------------------------------------------------
+
+	[[nodiscard]] vault GetVehicleType(const address vehicle)
+	{
+		return vehicleTypes.GetValue(vehicle, 0x0, [vehicle]() -> vault {return Globals::GetVehicleType(vehicle);});
+	}
+
+
+
+	[[nodiscard]] address GetFromPursuitlevel
+	(
+		const address pursuit,
+		const vault   attributeKey
+	) {
+		const auto Lookup = [=]() -> address {return Globals::GetFromPursuitlevel(pursuit, attributeKey);};
+		return pursuitAttributes.GetValue(pursuit, attributeKey, Lookup);
+	}
+
+
+
+
+
+	// State management -----------------------------------------------------------------------------------------------------------------------------
+
+	void NotifyOfRemovedVehicle(const address vehicle)
+	{
+		vehicleTypes.Forget(vehicle);
+	}
+
+
+
+	void NotifyOfDeletedPursuit(const address pursuit)
+	{
+		pursuitAttributes.Forget(pursuit);
+	}
+
+
+
+	void __fastcall NotifyOfHeatLevelChange(const address perpVehicle)
+	{
+		// Pursuit levels follow the Heat level of their perpetrator
+		const address pursuit = Globals::GetPursuitOfPerpVehicle(perpVehicle);
+		if (not pursuit) return; // not in pursuit
+
+		pursuitAttributes.Forget(pursuit);
+	}
+
+
+
+	void NotifyOfHeatStateUpdate()
+	{
+		// Pursuit levels may have changed within the current tick
+		pursuitAttributes.Clear();
+
+		if constexpr (Globals::loggingEnabled)
+		{
+			Globals::LogTagged(logTag, "Lookup statistics");
+
+			vehicleTypes     .Log("Vehicle types:     ");
+			pursuitAttributes.Log("Pursuit attributes:");
+		}
+	}
+}
\ No newline at end of file
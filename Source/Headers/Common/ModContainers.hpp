@@ -7,6 +7,7 @@
 #include <type_traits>
 
 #include "Globals.hpp"
+#include "TypeIndices.hpp"
 
 #include "../Utilities/MemoryTools.hpp"
 #include "../Utilities/FlatContainers.hpp"
@@ -132,10 +133,12 @@ namespace ModContainers
 	requires (std::is_trivially_copyable_v<K> and std::is_trivially_copyable_v<V>)
 	class DefaultMap : protected Map<K, V>
 	{
-	private: // members
+	protected: // members
 
 		V defaultValue;
 
+	private: // members
+
 		[[no_unique_address]] const LogLiteral name;
 
 
@@ -289,14 +292,91 @@ namespace ModContainers
 
 
 
-	// Scoped aliases (cont.) -----------------------------------------------------------------------------------------------------------------------
+	// DefaultVaultMap class ------------------------------------------------------------------------------------------------------------------------
 
 	#define DEFAULT_VAULT_MAP(type, name, ...) ModContainers::DefaultVaultMap<type> name{#name, __VA_ARGS__}
 
 	template <typename V>
-	using DefaultVaultMap = DefaultMap<vault, V>;
+	class DefaultVaultMap : public DefaultMap<vault, V>
+	{
+	private: // aliases
+
+		using Base      = DefaultMap<vault, V>;
+		using TypeIndex = TypeIndices::TypeIndex;
+
+
+	private: // members
+
+		std::vector<V> indexToValue; // dense; unknown and unlisted types hold the default value
+
+
+	public: // methods
+
+		constexpr DefaultVaultMap
+		(
+			const LogLiteral name, 
+			const V          defaultValue
+		) 
+			: Base(name, defaultValue) 
+		{
+		}
+
+
+		template <typename DefaultK, class KeySetup, class ValueSetup>
+		bool Fill
+		(
+			const DefaultK&  defaultKey,
+			const KeySetup   keySetup,
+			const ValueSetup valueSetup
+		) {
+			const bool isValid = this->Base::Fill(defaultKey, keySetup, valueSetup);
 
+			// Compile dense lookup array (valid types may join the dictionary here)
+			for (const auto& [key, value] : *this)
+				TypeIndices::Register(key);
 
+			this->indexToValue.assign(TypeIndices::GetNumIndices(), this->defaultValue);
+
+			for (const auto& [key, value] : *this)
+				this->indexToValue[TypeIndices::GetIndex(key)] = value;
+
+			this->indexToValue.shrink_to_fit();
+
+			return isValid;
+		}
+
+
+		[[nodiscard]] const V& GetReferenceByIndex(const TypeIndex index) const
+		{
+			// Types registered after this map was filled aren't listed in it
+			return (index < this->indexToValue.size()) ? this->indexToValue[index] : this->defaultValue;
+		}
+
+
+		[[nodiscard]] V GetValueByIndex(const TypeIndex index) const
+		{
+			return this->GetReferenceByIndex(index);
+		}
+
+
+		// Callers without a type index search this map's own keys, as these are fewer than all indexed types
+		[[nodiscard]] const V& GetReference(const vault key) const
+		{
+			return this->Base::GetReference(key);
+		}
+
+
+		[[nodiscard]] V GetValue(const vault key) const
+		{
+			return this->GetReference(key);
+		}
+	};
+
+
+
+
+
+	// Scoped aliases (cont.) -----------------------------------------------------------------------------------------------------------------------
 
 	#define DEFAULT_ADDRESS_MAP(type, name, ...) ModContainers::DefaultAddressMap<type> name{#name, __VA_ARGS__}
 
@@ -387,9 +467,14 @@ namespace ModContainers
 
 		template <class Object = ObjectBase, typename... ValArgs>
 		requires std::derived_from<Object, ObjectBase>
-		void EmplaceObject(ValArgs&&... args)
+		Object& EmplaceObject(ValArgs&&... args)
 		{
-			this->pointers.push_back(std::make_unique<Object>(std::forward<ValArgs>(args)...));
+			auto  object    = std::make_unique<Object>(std::forward<ValArgs>(args)...);
+			auto& reference = *object;
+
+			this->pointers.push_back(std::move(object));
+
+			return reference;
 		}
 
 
@@ -5,6 +5,7 @@
 #include <string_view>
 
 #include "Globals.hpp"
+#include "TypeIndices.hpp"
 #include "ModContainers.hpp"
 #include "HeatParameters.hpp"
 
@@ -89,31 +90,28 @@ namespace ParameterSets
 		}
 
 
-		float GetTaggingChange(const address copVehicle) const
+		float GetTaggingChange(const TypeIndices::TypeIndex copTypeIndex) const
 		{
-			const vault copType = Globals::GetVehicleType(copVehicle);
-			return this->copTagChange.current + this->copTypeToTagChange.GetValue(copType);
+			return this->copTagChange.current + this->copTypeToTagChange.GetValueByIndex(copTypeIndex);
 		}
 
 
 		float GetAssaultChange
 		(
-			const address copVehicle,
-			const byte    numCopAssaulted
+			const TypeIndices::TypeIndex copTypeIndex,
+			const byte                   numCopAssaulted
 		)
 			const
 		{
 			if (not this->GetsCreditForAssault(numCopAssaulted)) return 0.f;
 
-			const vault copType = Globals::GetVehicleType(copVehicle);
-			return this->changePerAssault.current + this->copTypeToAssaultChange.GetValue(copType);
+			return this->changePerAssault.current + this->copTypeToAssaultChange.GetValueByIndex(copTypeIndex);
 		}
 
 
-		float GetWreckingChange(const address copVehicle) const
+		float GetWreckingChange(const TypeIndices::TypeIndex copTypeIndex) const
 		{
-			const vault copType = Globals::GetVehicleType(copVehicle);
-			return this->copWreckChange.current + this->copTypeToWreckChange.GetValue(copType);
+			return this->copWreckChange.current + this->copTypeToWreckChange.GetValueByIndex(copTypeIndex);
 		}
 
 
@@ -1,10 +1,12 @@
 #pragma once
 
-#include <string>
+#include <memory>
+#include <vector>
+#include <utility>
+#include <algorithm>
 #include <string_view>
 
 #include "Globals.hpp"
-#include "ModContainers.hpp"
 
 
 
@@ -12,7 +14,62 @@ namespace PersistentStrings
 {
 	// Parameters -----------------------------------------------------------------------------------------------------------------------------------
 
-	RELEASE_CONSTINIT ModContainers::StableVaultMap<const std::string> vaultHashToString;
+	// Logging
+	constexpr LogLiteral logTag = "[PER]";
+
+	// String pool (chunks are never freed, so interned strings stay valid until game process terminates)
+	constexpr size_t chunkSize = 4096; // bytes
+
+	RELEASE_CONSTINIT std::vector<std::unique_ptr<char[]>> chunks;
+
+	char*  chunkHead      = nullptr;
+	size_t chunkRemainder = 0; // bytes
+
+	// Dictionaries (first sorted by vault hash for O(log n) lookups, second only for rare hash collisions)
+	RELEASE_CONSTINIT std::vector<std::pair<vault, const char*>> hashToString;
+	RELEASE_CONSTINIT std::vector<std::pair<vault, const char*>> collidedStrings;
+
+
+
+
+
+	// Auxiliary functions --------------------------------------------------------------------------------------------------------------------------
+
+	[[nodiscard]] auto FindPair(const vault hash)
+	{
+		const auto IsLess = [](const std::pair<vault, const char*>& pair, const vault hash) -> bool {return (pair.first < hash);};
+		return std::lower_bound(hashToString.begin(), hashToString.end(), hash, IsLess);
+	}
+
+
+
+	[[nodiscard]] const char* Allocate(const std::string_view string)
+	{
+		const size_t numBytes = string.length() + 1; // including NUL terminator
+
+		if (numBytes > chunkRemainder)
+		{
+			// Oversized strings get their own chunk, so the current one stays in use
+			if (numBytes > chunkSize / 4)
+			{
+				char* const chunk = chunks.emplace_back(std::make_unique<char[]>(numBytes)).get();
+				string.copy(chunk, string.length());
+
+				return chunk; // zero-initialised, so terminated
+			}
+
+			chunkHead      = chunks.emplace_back(std::make_unique<char[]>(chunkSize)).get();
+			chunkRemainder = chunkSize;
+		}
+
+		char* const interned = chunkHead;
+		string.copy(interned, string.length());
+
+		chunkHead      += numBytes;
+		chunkRemainder -= numBytes;
+
+		return interned; // zero-initialised, so terminated
+	}
 
 
 
@@ -20,27 +77,51 @@ namespace PersistentStrings
 
 	// Management functions -------------------------------------------------------------------------------------------------------------------------
 
-	[[nodiscard]] const std::string* Get(const vault hash)
+	[[nodiscard]] const char* Get(const vault hash)
 	{
-		const auto foundHash = vaultHashToString.find(hash);
-		if (foundHash == vaultHashToString.end()) return nullptr;
+		const auto foundPair = FindPair(hash);
+		if ((foundPair == hashToString.end()) or (foundPair->first != hash)) return nullptr;
 
-		return foundHash->second.get();
+		return foundPair->second;
 	}
 
 
 
-	[[nodiscard]] const std::string& Create
+	[[nodiscard]] const char* Create
 	(
 		const vault            hash,
 		const std::string_view string
 	) {
-		const auto [pairIt, isNewHash] = vaultHashToString.try_emplace(hash, string);
-		return *(pairIt->second); // guaranteed to stay valid until game process terminates
+		const auto foundPair = FindPair(hash);
+
+		if ((foundPair != hashToString.end()) and (foundPair->first == hash))
+		{
+			if (string == foundPair->second) return foundPair->second;
+
+			// Colliding strings are compared in full, so neither string is aliased
+			for (const auto& [collidedHash, collidedString] : collidedStrings)
+			{
+				if ((collidedHash == hash) and (string == collidedString))
+					return collidedString;
+			}
+
+			if constexpr (Globals::loggingEnabled)
+				Globals::LogError(logTag, "Hash collision:", hash, foundPair->second, string);
+
+			const char* const interned = Allocate(string);
+			collidedStrings.emplace_back(hash, interned);
+
+			return interned;
+		}
+
+		const char* const interned = Allocate(string);
+		hashToString.emplace(foundPair, hash, interned);
+
+		return interned;
 	}
 
 
-	[[nodiscard]] const std::string& Create(const std::string_view string)
+	[[nodiscard]] const char* Create(const std::string_view string)
 	{
 		return Create(Globals::GetVaultHash(string), string);
 	}
@@ -52,7 +133,7 @@ namespace PersistentStrings
 		const vault       hash,
 		std::string_view& string
 	) {
-		string = Create(hash, string);
+		string = {Create(hash, string), string.length()};
 	}
 
 
@@ -70,7 +151,7 @@ namespace PersistentStrings
 	) {
 		if (not string) return; // UB with std::string_view constructor
 
-		string = Create(hash, string).c_str();
+		string = Create(hash, string);
 	}
 
 
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+#include "Globals.hpp"
+#include "LookupCaches.hpp"
+
+
+
+namespace TypeIndices
+{
+	// Scoped aliases -------------------------------------------------------------------------------------------------------------------------------
+
+	using TypeIndex = uint16_t;
+
+
+
+
+
+	// Parameters -----------------------------------------------------------------------------------------------------------------------------------
+
+	// Logging
+	constexpr LogLiteral logTag = "[IDX]";
+
+	// Index 0 is shared by all vehicle types no configuration file refers to
+	constexpr TypeIndex unknownIndex = 0;
+
+	// Dictionary (sorted by vault hash)
+	RELEASE_CONSTINIT std::vector<std::pair<vault, TypeIndex>> typeToIndex;
+
+
+
+
+
+	// Auxiliary functions --------------------------------------------------------------------------------------------------------------------------
+
+	[[nodiscard]] auto FindPair(const vault type)
+	{
+		const auto IsLess = [](const std::pair<vault, TypeIndex>& pair, const vault type) -> bool {return (pair.first < type);};
+		return std::lower_bound(typeToIndex.begin(), typeToIndex.end(), type, IsLess);
+	}
+
+
+
+
+
+	// Management functions -------------------------------------------------------------------------------------------------------------------------
+
+	[[nodiscard]] size_t GetNumIndices()
+	{
+		return typeToIndex.size() + 1; // including unknown
+	}
+
+
+
+	[[nodiscard]] TypeIndex GetIndex(const vault type)
+	{
+		const auto foundPair = FindPair(type);
+		if ((foundPair == typeToIndex.end()) or (foundPair->first != type)) return unknownIndex;
+
+		return foundPair->second;
+	}
+
+
+	[[nodiscard]] TypeIndex GetIndexOfVehicle(const address vehicle)
+	{
+		return GetIndex(LookupCaches::GetVehicleType(vehicle));
+	}
+
+
+
+	// Should only be called while parsing, as this may grow the dictionary
+	TypeIndex Register(const vault type)
+	{
+		const auto foundPair = FindPair(type);
+		if ((foundPair != typeToIndex.end()) and (foundPair->first == type)) return foundPair->second;
+
+		if (GetNumIndices() > std::numeric_limits<TypeIndex>::max())
+		{
+			if constexpr (Globals::loggingEnabled)
+				Globals::LogError(logTag, "Index limit reached for", type);
+
+			return unknownIndex; // should never happen
+		}
+
+		const auto newIndex = static_cast<TypeIndex>(GetNumIndices());
+		typeToIndex.emplace(foundPair, type, newIndex);
+
+		return newIndex;
+	}
+}
\ No newline at end of file
@@ -1,8 +1,10 @@
 #pragma once
 
-#include <functional>
+#include <vector>
+#include <algorithm>
 
 #include "../../Common/Globals.hpp"
+#include "../../Common/LookupCaches.hpp"
 #include "../../Common/ModContainers.hpp"
 #include "../../Common/HeatParameters.hpp"
 
@@ -57,9 +59,61 @@ namespace CopFleeOverrides
 
 	namespace Details
 	{
+		// Bail policy for cops without alternatives to fleeing
+		struct AlwaysBail
+		{
+		// Methods
+
+			[[nodiscard]] static bool ShouldExpiredVehicleBail(const address copVehicle)
+			{
+				return true;
+			}
+		};
+
+
+
+		// Schedule policy for cops that may always expire
+		struct AlwaysSchedulable
+		{
+		// Methods
+
+			[[nodiscard]] static bool IsSchedulable(const address copVehicle)
+			{
+				return true;
+			}
+		};
+
+
+
+		// Schedule policy for "Chasers", which may only expire if they aren't in the current spawn table
+		struct NotInChaserTable
+		{
+		// Methods
+
+			[[nodiscard]] static bool IsSchedulable(const address copVehicle)
+			{
+				const vault copType = LookupCaches::GetVehicleType(copVehicle);
+				return (not CopSpawnTables::chaserSpawnTable.current->ContainsCopType(copType));
+			}
+		};
+
+
+
 		// Base expiration-time tracker for cops
+		template <class Scheduler>
 		class SchedulerBase
 		{
+		private: // types
+
+			struct Deadline
+			{
+			// Members
+
+				float   timestamp;
+				address copVehicle;
+			};
+
+
 		protected: // members
 
 			size_t numPendingExpired = 0;
@@ -67,13 +121,7 @@ namespace CopFleeOverrides
 			const address    pursuit;
 			const LogLiteral vehicleLabel;
 
-			ModContainers::AddressMap<float> copVehicleToTimestamp;
-
-			// Whether currently scheduled cops should be checked for expiration
-			std::function<bool ()> ShouldCheckForExpiration = []() -> bool {return true;};
-
-			// Whether a given expired cop vehicle should actually be forced to bail the pursuit
-			std::function<bool (const address)> ShouldExpiredVehicleBail = [](const address copVehicle) -> bool {return true;};
+			std::vector<Deadline> deadlines; // sorted by descending timestamp, so the next to expire is last
 
 
 		protected: // methods
@@ -95,20 +143,42 @@ namespace CopFleeOverrides
 			SchedulerBase& operator=(const SchedulerBase&) = delete;
 
 
+			[[nodiscard]] auto FindDeadline(const address copVehicle)
+			{
+				const auto IsOfVehicle = [=](const Deadline& deadline) -> bool {return (deadline.copVehicle == copVehicle);};
+				return std::find_if(this->deadlines.begin(), this->deadlines.end(), IsOfVehicle);
+			}
+
+
 			void ScheduleVehicle
 			(
 				const address copVehicle,
 				const float   fleeTimer
 			) {
-				const auto [pairIt, isNewVehicle] = this->copVehicleToTimestamp.try_emplace(copVehicle, Globals::simulationTime + fleeTimer);
-
-				if constexpr (Globals::loggingEnabled)
+				if (this->FindDeadline(copVehicle) != this->deadlines.end())
 				{
-					if (isNewVehicle)
-						Globals::LogFull(this->pursuit, logTag, copVehicle, "expires in", fleeTimer);
+					if constexpr (Globals::loggingEnabled)
+						Globals::LogError(logTag, copVehicle, "already scheduled");
 
-					else Globals::LogError(logTag, copVehicle, "already scheduled");
+					return; // should never happen
 				}
+
+				const float timestamp = Globals::simulationTime + fleeTimer;
+				const auto  IsLater   = [](const float timestamp, const Deadline& deadline) -> bool {return (timestamp > deadline.timestamp);};
+
+				this->deadlines.emplace(std::upper_bound(this->deadlines.begin(), this->deadlines.end(), timestamp, IsLater), timestamp, copVehicle);
+
+				if constexpr (Globals::loggingEnabled)
+					Globals::LogFull(this->pursuit, logTag, copVehicle, "expires in", fleeTimer);
+			}
+
+
+			void UnscheduleVehicle(const address copVehicle)
+			{
+				const auto foundDeadline = this->FindDeadline(copVehicle);
+
+				if (foundDeadline != this->deadlines.end())
+					this->deadlines.erase(foundDeadline);
 			}
 
 
@@ -131,76 +201,78 @@ namespace CopFleeOverrides
 
 			void CheckTimestamps()
 			{
-				auto pairIt = this->copVehicleToTimestamp.begin();
+				auto* const scheduler = static_cast<Scheduler*>(this);
 
-				while ((pairIt != this->copVehicleToTimestamp.end()) and this->ShouldCheckForExpiration())
+				while ((not this->deadlines.empty()) and scheduler->ShouldCheckForExpiration())
 				{
-					const auto& [copVehicle, timestamp] = *pairIt;
-
-					if (Globals::simulationTime >= timestamp)
-					{
-						if (this->ShouldExpiredVehicleBail(copVehicle))
-							this->MakeVehicleBail(copVehicle);
-						
-						pairIt = this->copVehicleToTimestamp.erase(pairIt);
-					}
-					else ++pairIt;
+					const Deadline deadline = this->deadlines.back();
+					if (Globals::simulationTime < deadline.timestamp) return; // all others expire even later
+
+					this->deadlines.pop_back();
+
+					if (scheduler->ShouldExpiredVehicleBail(deadline.copVehicle))
+						this->MakeVehicleBail(deadline.copVehicle);
 				}
 			}
 
 
 			void ForceTriggerExpiration()
 			{
-				for (const auto& [copVehicle, timestamp] : this->copVehicleToTimestamp)
+				auto* const scheduler = static_cast<Scheduler*>(this);
+
+				for (const auto& [timestamp, copVehicle] : this->deadlines)
 				{
-					if (this->ShouldExpiredVehicleBail(copVehicle))
+					if (scheduler->ShouldExpiredVehicleBail(copVehicle))
 						this->MakeVehicleBail(copVehicle);
 
 					++(this->numPendingExpired);
 				}
 
-				this->copVehicleToTimestamp.clear();
+				this->deadlines.clear();
 				this->numPendingExpired = 0;
 			}
 
 
 			[[nodiscard]] size_t GetNumScheduled() const
 			{
-				return this->copVehicleToTimestamp.size() - this->numPendingExpired;
+				return this->deadlines.size() - this->numPendingExpired;
 			}
 		};
 
 
 
 		// Expiration-time tracker for Strategy cops
-		class StrategyScheduler : public SchedulerBase
+		template <class BailPolicy = AlwaysBail>
+		class StrategyScheduler : public SchedulerBase<StrategyScheduler<BailPolicy>>
 		{
-		private: // members
+		private: // aliases
 
-			const address& strategy;
+			using Base = SchedulerBase<StrategyScheduler>;
 
 
-		public: // aliases
+		private: // members
 
-			using SchedulerBase::ShouldExpiredVehicleBail;
+			const BailPolicy bailPolicy;
+			const address&   strategy;
 
 
 		public: // methods
 
 			StrategyScheduler
 			(
-				const address    pursuit,
-				const LogLiteral vehicleLabel,
-				const ptrdiff_t  strategyOffset
+				const address     pursuit,
+				const LogLiteral  vehicleLabel,
+				const ptrdiff_t   strategyOffset,
+				const BailPolicy& bailPolicy = {}
 			)
-				: SchedulerBase(pursuit, vehicleLabel), strategy(AsReference<address>(pursuit + strategyOffset))
+				: Base(pursuit, vehicleLabel), bailPolicy(bailPolicy), strategy(AsReference<address>(pursuit + strategyOffset))
 			{
 			}
 
 
 			void ReserveCapacity(const size_t numVehicles)
 			{
-				this->copVehicleToTimestamp.reserve(numVehicles);
+				this->deadlines.reserve(numVehicles);
 			}
 
 
@@ -213,7 +285,7 @@ namespace CopFleeOverrides
 
 			void RemoveVehicle(const address copVehicle)
 			{
-				this->copVehicleToTimestamp.erase(copVehicle);
+				this->UnscheduleVehicle(copVehicle);
 			}
 
 
@@ -221,26 +293,38 @@ namespace CopFleeOverrides
 			{
 				return this->strategy;
 			}
+
+
+			// Scheduled Strategy cops always expire on time
+			[[nodiscard]] bool ShouldCheckForExpiration() const
+			{
+				return true;
+			}
+
+
+			[[nodiscard]] bool ShouldExpiredVehicleBail(const address copVehicle) const
+			{
+				return this->bailPolicy.ShouldExpiredVehicleBail(copVehicle);
+			}
 		};
 
 
 
 		// Expiration-time tracker for non-Strategy cops
-		class PursuitScheduler : public SchedulerBase
+		template <class SchedulePolicy = AlwaysSchedulable>
+		class PursuitScheduler : public SchedulerBase<PursuitScheduler<SchedulePolicy>>
 		{
-		public: // members
+		private: // aliases
 
-			// Total number of active "Chasers"
-			std::function<size_t ()> GetNumActiveChasers = []() -> size_t {return 8;};
-
-			// Whether a given cop vehicle may be scheduled for expiration
-			std::function<bool (const address)> IsSchedulable = [](const address copVehicle) -> bool {return true;};
+			using Base = SchedulerBase<PursuitScheduler>;
 
 
 		private: // members
 
 			ModContainers::AddressSet copVehicles; // for tracking in case of Heat transitions
 
+			const ModContainers::AddressSet& chaserVehicles; // total number of active "Chasers"
+
 			const HeatParameters::OptionalInterval<float>& fleeDelay;
 			const HeatParameters::OptionalValue   <int>&   fleeThreshold;
 
@@ -249,9 +333,9 @@ namespace CopFleeOverrides
 
 			void ReviewVehicle(const address copVehicle)
 			{
-				if (not Globals::playerHeatLevelKnown)     return;
-				if (not this->IsSchedulable(copVehicle))   return;
-				if (not this->fleeDelay.isEnabled.current) return;
+				if (not Globals::playerHeatLevelKnown)             return;
+				if (not SchedulePolicy::IsSchedulable(copVehicle)) return;
+				if (not this->fleeDelay.isEnabled.current)         return;
 
 				this->ScheduleVehicle(copVehicle, this->fleeDelay.interval.GetRandomValue());
 			}
@@ -264,37 +348,24 @@ namespace CopFleeOverrides
 				const address                                  pursuit,
 				const LogLiteral                               vehicleLabel,
 				const HeatParameters::OptionalInterval<float>& fleeDelay,
-				const HeatParameters::OptionalValue   <int>&   fleeThreshold
+				const HeatParameters::OptionalValue   <int>&   fleeThreshold,
+				const ModContainers::AddressSet* const         chaserVehicles = nullptr // own vehicles if null
 			)
-				: SchedulerBase(pursuit, vehicleLabel), fleeDelay(fleeDelay), fleeThreshold(fleeThreshold)
+				: Base(pursuit, vehicleLabel), chaserVehicles((chaserVehicles) ? *chaserVehicles : this->copVehicles), fleeDelay(fleeDelay), fleeThreshold(fleeThreshold)
 			{
-				// Scheduled non-Strategy cops may only expire if the number of "Chasers" is above some threshold
-				this->ShouldCheckForExpiration = [this]() -> bool
-				{
-					if (this->fleeThreshold.isEnabled.current)
-						return (static_cast<int>(this->GetNumActiveChasers()) > this->fleeThreshold.value.current);
-
-					return true;
-				};
-
-				// Expired pursuit cops always bail and must also be un-tracked
-				this->ShouldExpiredVehicleBail = [this](const address copVehicle) -> bool
-				{
-					return this->copVehicles.erase(copVehicle);
-				};
 			}
 			
 
 			void ReserveCapacity(const size_t numVehicles)
 			{
-				this->copVehicles          .reserve(numVehicles);
-				this->copVehicleToTimestamp.reserve(numVehicles);
+				this->copVehicles.reserve(numVehicles);
+				this->deadlines  .reserve(numVehicles);
 			}
 
 
 			void ReviewAllVehicles()
 			{
-				this->copVehicleToTimestamp.clear();
+				this->deadlines.clear();
 
 				for (const address copVehicle : this->copVehicles)
 					this->ReviewVehicle(copVehicle);
@@ -310,8 +381,8 @@ namespace CopFleeOverrides
 
 			void RemoveVehicle(const address copVehicle)
 			{
-				this->copVehicles          .erase(copVehicle);
-				this->copVehicleToTimestamp.erase(copVehicle);
+				this->copVehicles.erase(copVehicle);
+				this->UnscheduleVehicle(copVehicle);
 			}
 
 
@@ -319,8 +390,30 @@ namespace CopFleeOverrides
 			{
 				return this->copVehicles.size();
 			}
-		};
 
+
+			[[nodiscard]] const ModContainers::AddressSet& GetVehicles() const
+			{
+				return this->copVehicles;
+			}
+
+
+			// Scheduled non-Strategy cops may only expire if the number of "Chasers" is above some threshold
+			[[nodiscard]] bool ShouldCheckForExpiration() const
+			{
+				if (this->fleeThreshold.isEnabled.current)
+					return (static_cast<int>(this->chaserVehicles.size()) > this->fleeThreshold.value.current);
+
+				return true;
+			}
+
+
+			// Expired pursuit cops always bail and must also be un-tracked
+			bool ShouldExpiredVehicleBail(const address copVehicle)
+			{
+				return this->copVehicles.erase(copVehicle);
+			}
+		};
 	}
 
 
@@ -333,20 +426,43 @@ namespace CopFleeOverrides
 	{
 	private: // aliases
 
-		using StrategyScheduler = Details::StrategyScheduler;
-		using PursuitScheduler  = Details::PursuitScheduler;
+		template <class BailPolicy = Details::AlwaysBail>
+		using StrategyScheduler = Details::StrategyScheduler<BailPolicy>;
+
+		template <class SchedulePolicy = Details::AlwaysSchedulable>
+		using PursuitScheduler = Details::PursuitScheduler<SchedulePolicy>;
+
+
+	private: // types
+
+		// Expired Heavy3 vehicles only bail if they cannot join as pursuit cops
+		struct HeavyBailPolicy
+		{
+		// Members
+
+			MembershipManager& manager;
+
+
+		// Methods
+
+			[[nodiscard]] bool ShouldExpiredVehicleBail(const address copVehicle) const
+			{
+				return (not this->manager.MakeHeavyVehicleJoin(copVehicle));
+			}
+		};
 
 
 	private: // members
 
 		bool pursuitTargetKnown = false;
 
-		StrategyScheduler heavyVehicles {this->pursuit, "Heavy",  0x194};
-		StrategyScheduler leaderVehicles{this->pursuit, "Leader", 0x198};
+		StrategyScheduler<HeavyBailPolicy> heavyVehicles {this->pursuit, "Heavy",  0x194, HeavyBailPolicy{*this}};
+		StrategyScheduler<>                leaderVehicles{this->pursuit, "Leader", 0x198};
+
+		PursuitScheduler<Details::NotInChaserTable> chaserVehicles{this->pursuit, "Chaser", chaserFleeDelay, chaserThreshold};
 
-		PursuitScheduler chaserVehicles         {this->pursuit, "Chaser",    chaserFleeDelay,          chaserThreshold};
-		PursuitScheduler joinedHeavyVehicles    {this->pursuit, "Joined H3", joinedHeavy3FleeDelay,    joinedHeavy3Threshold};
-		PursuitScheduler joinedRoadblockVehicles{this->pursuit, "Joined RB", joinedRoadblockFleeDelay, joinedRoadblockThreshold};
+		PursuitScheduler<> joinedHeavyVehicles    {this->pursuit, "Joined H3", joinedHeavy3FleeDelay,    joinedHeavy3Threshold,    &(this->chaserVehicles.GetVehicles())};
+		PursuitScheduler<> joinedRoadblockVehicles{this->pursuit, "Joined RB", joinedRoadblockFleeDelay, joinedRoadblockThreshold, &(this->chaserVehicles.GetVehicles())};
 
 		const bool& isJerk = AsReference<bool>(this->pursuit + 0x238);
 
@@ -355,13 +471,6 @@ namespace CopFleeOverrides
 
 	private: // methods
 
-		[[nodiscard]] static bool IsNotInChaserTable(const address copVehicle)
-		{
-			const vault copType = Globals::GetVehicleType(copVehicle);
-			return (not CopSpawnTables::chaserSpawnTable.current->ContainsCopType(copType));
-		}
-
-
 		[[nodiscard]] bool MayAnotherHeavyJoin() const
 		{
 			if (not heavy3JoiningEnabled     .current) return false;
@@ -449,22 +558,6 @@ namespace CopFleeOverrides
 			if constexpr (Globals::loggingEnabled)
 				Globals::LogPlain('+', this, this->name);
 
-			// Expired Heavy3 vehicles only bail if they cannot join as pursuit cops
-			this->heavyVehicles.ShouldExpiredVehicleBail = [this](const address copVehicle) -> bool
-			{
-				return (not this->MakeHeavyVehicleJoin(copVehicle));
-			};
-
-			// Scheduled non-Strategy cops may only expire if the number of "Chasers" is above some threshold
-			const auto GetNumActiveChasers = [this]() -> size_t {return this->chaserVehicles.GetNumVehicles();};
-
-			this->chaserVehicles         .GetNumActiveChasers = GetNumActiveChasers;
-			this->joinedHeavyVehicles    .GetNumActiveChasers = GetNumActiveChasers;
-			this->joinedRoadblockVehicles.GetNumActiveChasers = GetNumActiveChasers;
-
-			// "Chasers" may only be scheduled for expiration if they aren't in the current spawn table
-			this->chaserVehicles.IsSchedulable = MembershipManager::IsNotInChaserTable;
-
 			// Container pre-allocations
 			this->heavyVehicles .ReserveCapacity(10);
 			this->leaderVehicles.ReserveCapacity(10);
@@ -482,6 +575,21 @@ namespace CopFleeOverrides
 		}
 
 
+		[[nodiscard]] static bool TracksCopLabel(const CopLabel copLabel)
+		{
+			switch (copLabel)
+			{
+			case CopLabel::CHASER:
+			case CopLabel::HEAVY:
+			case CopLabel::LEADER:
+			case CopLabel::ROADBLOCK:
+				return true;
+			}
+
+			return false;
+		}
+
+
 		void ReactToGameplay() override 
 		{
 			this->CheckForHeavyCancellation();
@@ -514,8 +622,9 @@ namespace CopFleeOverrides
 
 		void ReactToAddedVehicle
 		(
-			const address  copVehicle,
-			const CopLabel copLabel
+			const address   copVehicle,
+			const CopLabel  copLabel,
+			const TypeIndex copTypeIndex
 		) 
 			override
 		{
@@ -541,8 +650,9 @@ namespace CopFleeOverrides
 
 		void ReactToRemovedVehicle
 		(
-			const address  copVehicle,
-			const CopLabel copLabel
+			const address   copVehicle,
+			const CopLabel  copLabel,
+			const TypeIndex copTypeIndex
 		) 
 			override
 		{
@@ -1,11 +1,15 @@
 #pragma once
 
+#include <array>
+#include <vector>
+#include <algorithm>
 #include <string_view>
 
 #include "../../Common/Globals.hpp"
+#include "../../Common/TypeIndices.hpp"
+#include "../../Common/LookupCaches.hpp"
 #include "../../Common/ModContainers.hpp"
 #include "../../Common/HeatParameters.hpp"
-#include "../../Common/PersistentStrings.hpp"
 
 #include "../../Utilities/MemoryTools.hpp"
 
@@ -27,6 +31,9 @@ namespace CopSpawnOverrides
 	constexpr LogLiteral logTag  = "[SPA]";
 	constexpr LogLiteral logName = "CopSpawnOverrides";
 
+	// Separate stream for prefetched vehicle names, so prefetching never shifts other features' draws
+	RandomNumbers::Generator prefetchPRNG;
+
 
 
 
@@ -37,19 +44,29 @@ namespace CopSpawnOverrides
 	{
 	private: // aliases
 
-		using TablePointer = HeatParameters::Pointer<CopSpawnTables::SpawnTable>;
+		using TypeIndex    = TypeIndices::TypeIndex;
+		using SpawnTable   = CopSpawnTables::SpawnTable;
+		using TablePointer = HeatParameters::Pointer<SpawnTable>;
 
 
 	private: // members
 
-		int numTotalActiveCops = 0;
+		int numTotalActiveCops    = 0;
+		int currentTotalCopChance = 0; // of available entries in current table
 
 		const address             pursuit;
 		const TablePointer* const source; // can't be a reference, else MSVC claims constinit-incompatibility
-		
-		CopSpawnTables::SpawnTable table;
+		const SpawnTable*         table;  // shared and immutable
+
+		std::vector<int> typeToNumActive; // dense; also covers Heat transitions and cops not in table
+
+		inline static constexpr size_t prefetchSize = 4;
+
+		mutable size_t                                numPrefetchedNames = 0;
+		mutable size_t                                numConsumedNames   = 0; // since last prefetch
+		mutable std::array<const char*, prefetchSize> prefetchedNames    = {};  // drawn under current availability
 
-		ModContainers::VaultMap<int> copTypeToNumActive; // for Heat transitions and cops not in table
+		inline static const SpawnTable emptyTable;
 
 		inline static constexpr LogLiteral tag  = "[CON]";
 		inline static constexpr LogLiteral name = "Contingent";
@@ -57,21 +74,47 @@ namespace CopSpawnOverrides
 
 	private: // methods
 
-		void ChangeNumActiveCopsInSpawnTable
+		void ChangeNumActiveCops
 		(
-			const vault copType, 
-			const int   change
+			const TypeIndex typeIndex,
+			const int       change
 		) {
-			const bool copTypeInSpawnTable = this->table.ChangeNumActiveCops(copType, change);
-			
+			if (typeIndex >= this->typeToNumActive.size())
+				this->ResizeTypeCounts();
+
+			int&       numActive = this->typeToNumActive[typeIndex];
+			const auto entryID   = this->table->FindEntryID(typeIndex);
+
+			if (entryID)
+			{
+				const auto& copEntry     = this->table->GetCopEntry(*entryID);
+				const bool  wasAvailable = copEntry.IsAvailable(numActive);
+
+				numActive += change;
+
+				if (wasAvailable != copEntry.IsAvailable(numActive))
+				{
+					this->currentTotalCopChance += (wasAvailable) ? -copEntry.chance : copEntry.chance;
+					this->InvalidatePrefetchedNames();
+				}
+			}
+			else numActive += change;
+
+			this->numTotalActiveCops += change;
+
 			if constexpr (Globals::loggingEnabled)
 			{
+				if (numActive < 0)
+					Globals::LogError(this->tag, "Negative active count for index", typeIndex);
+
 				if (this->pursuit)
 				{
-					if (copTypeInSpawnTable)
-						Globals::LogFull(this->pursuit, this->tag, "Type capacity:", this->table.GetNumAvailableCops(copType));
+					if (entryID)
+						Globals::LogFull(this->pursuit, this->tag, "Type capacity:", this->table->GetCopEntry(*entryID).maxCount - numActive);
 
 					else Globals::LogFull(this->pursuit, this->tag, "Type capacity undefined");
+
+					Globals::LogPlain("Type ratio:", numActive, '/', this->numTotalActiveCops);
 				}
 			}
 		}
@@ -79,16 +122,19 @@ namespace CopSpawnOverrides
 
 	public: // methods
 
-		constexpr explicit Contingent(const TablePointer& source) : source(&source), pursuit(0x0) {}
+		constexpr explicit Contingent(const TablePointer& source) : source(&source), pursuit(0x0), table(&emptyTable) {}
 
 
 		Contingent
 		(
 			const TablePointer& source,
 			const address       pursuit
-		) 
-			: source(&source), pursuit(pursuit), table(*(source.current))
+		)
+			: source(&source), pursuit(pursuit), table((source.current) ? source.current : &emptyTable)
 		{
+			this->ResizeTypeCounts();
+			this->currentTotalCopChance = this->table->GetTotalCopChance();
+
 			if constexpr (Globals::loggingEnabled)
 			{
 				if (this->pursuit)
@@ -114,30 +160,34 @@ namespace CopSpawnOverrides
 		}
 
 
-		void ReserveCapacity(const size_t numTypes)
+		void ResizeTypeCounts()
 		{
-			this->copTypeToNumActive.reserve(numTypes);
+			this->typeToNumActive.resize(TypeIndices::GetNumIndices(), 0);
 		}
 
 
 		void UpdateSpawnTable()
 		{
-			this->table = *(this->source->current);
+			if (this->source->current)
+				this->table = this->source->current;
 
-			for (const auto& [copType, currentCount] : this->copTypeToNumActive)
+			this->InvalidatePrefetchedNames();
+			this->currentTotalCopChance = 0;
+
+			for (size_t entryID = 0; entryID < this->table->GetNumCopEntries(); ++entryID)
 			{
+				const auto&  copEntry  = this->table->GetCopEntry(entryID);
+				const size_t typeIndex = copEntry.typeIndex;
+				const int    numActive = (typeIndex < this->typeToNumActive.size()) ? this->typeToNumActive[typeIndex] : 0;
+
+				if (copEntry.IsAvailable(numActive))
+					this->currentTotalCopChance += copEntry.chance;
+
 				if constexpr (Globals::loggingEnabled)
 				{
-					if (this->pursuit)
-					{
-						if (const auto* const copName = PersistentStrings::Get(copType))
-							Globals::LogFull(this->pursuit, this->tag, "Copying", currentCount, *copName);
-
-						else Globals::LogFull(this->pursuit, this->tag, "Copying", currentCount, copType);
-					}
+					if (this->pursuit and (numActive > 0))
+						Globals::LogFull(this->pursuit, this->tag, "Copying", numActive, copEntry.copName);
 				}
-
-				this->ChangeNumActiveCopsInSpawnTable(copType, +currentCount);
 			}
 		}
 
@@ -150,75 +200,47 @@ namespace CopSpawnOverrides
 					Globals::LogFull(this->pursuit, this->tag, "Clearing all vehicles");
 			}
 
-			this->table.ResetActiveCopCounts();
+			std::fill(this->typeToNumActive.begin(), this->typeToNumActive.end(), 0);
+
+			this->InvalidatePrefetchedNames();
 
-			this->copTypeToNumActive.clear();
-			this->numTotalActiveCops = 0;
+			this->numTotalActiveCops    = 0;
+			this->currentTotalCopChance = this->table->GetTotalCopChance();
 		}
 
 
-		void AddVehicleByType(const vault copType)
+		void AddVehicleByIndex(const TypeIndex typeIndex)
 		{
-			const auto [pairIt, isNewType] = this->copTypeToNumActive.try_emplace(copType, 1);
-			int&       numActiveCops       = pairIt->second;
-
-			if (not isNewType)
-				++numActiveCops;
-
-			++(this->numTotalActiveCops);
-
-			this->ChangeNumActiveCopsInSpawnTable(copType, /* change = */ +1);
-
-			if constexpr (Globals::loggingEnabled)
-			{
-				if (this->pursuit)
-					Globals::LogPlain("Type ratio:", numActiveCops, '/', this->numTotalActiveCops);
-			}
+			this->ChangeNumActiveCops(typeIndex, /* change = */ +1);
 		}
 
 
 		void AddVehicleByName(const std::string_view copName)
 		{
-			this->AddVehicleByType(Globals::GetVaultHash(copName));
+			this->AddVehicleByIndex(TypeIndices::GetIndex(Globals::GetVaultHash(copName)));
 		}
 
 
 		void AddVehicle(const address copVehicle)
 		{
-			this->AddVehicleByType(Globals::GetVehicleType(copVehicle));
+			this->AddVehicleByIndex(TypeIndices::GetIndexOfVehicle(copVehicle));
 		}
 
 
-		bool RemoveVehicleByType(const vault copType)
+		bool RemoveVehicleByIndex(const TypeIndex typeIndex)
 		{
-			const auto foundType = this->copTypeToNumActive.find(copType);
-
-			if (foundType == this->copTypeToNumActive.end())
+			if ((typeIndex >= this->typeToNumActive.size()) or (this->typeToNumActive[typeIndex] < 1))
 			{
 				if constexpr (Globals::loggingEnabled)
 				{
 					if (this->pursuit)
-						Globals::LogError(this->tag, "Unknown type", copType, "in", this->pursuit);
+						Globals::LogError(this->tag, "Unknown type index", typeIndex, "in", this->pursuit);
 				}
 
 				return false; // should never happen
 			}
 
-			int& numActiveCops = foundType->second;
-
-			--numActiveCops;
-			--(this->numTotalActiveCops);
-
-			this->ChangeNumActiveCopsInSpawnTable(copType, /* change = */ -1);
-				
-			if constexpr (Globals::loggingEnabled)
-			{
-				if (this->pursuit)
-					Globals::LogPlain("Type ratio:", numActiveCops, '/', this->numTotalActiveCops);
-			}
-
-			if (numActiveCops < 1)
-				this->copTypeToNumActive.erase(foundType);
+			this->ChangeNumActiveCops(typeIndex, /* change = */ -1);
 
 			return true;
 		}
@@ -226,13 +248,13 @@ namespace CopSpawnOverrides
 
 		bool RemoveVehicleByName(const std::string_view copName)
 		{
-			return this->RemoveVehicleByType(Globals::GetVaultHash(copName));
+			return this->RemoveVehicleByIndex(TypeIndices::GetIndex(Globals::GetVaultHash(copName)));
 		}
 
 
 		bool RemoveVehicle(const address copVehicle)
 		{
-			return this->RemoveVehicleByType(Globals::GetVehicleType(copVehicle));
+			return this->RemoveVehicleByIndex(TypeIndices::GetIndexOfVehicle(copVehicle));
 		}
 
 
@@ -244,19 +266,50 @@ namespace CopSpawnOverrides
 
 		[[nodiscard]] bool IsAnyCopAvailable() const
 		{
-			return this->table.IsAnyCopAvailable();
+			return (this->currentTotalCopChance > 0);
+		}
+
+
+		void InvalidatePrefetchedNames()
+		{
+			this->numPrefetchedNames = 0;
+		}
+
+
+		// Names drawn under unchanged availability follow the same distribution as fresh draws
+		void PrefetchNames()
+		{
+			if (not this->IsAnyCopAvailable()) return;
+
+			// Only replaces names actually consumed, so discarded prefetches don't cascade into more draws
+			while ((this->numConsumedNames > 0) and (this->numPrefetchedNames < prefetchSize))
+			{
+				const char* const copName = this->table->GetNameOfAvailableCop(this->typeToNumActive, this->currentTotalCopChance, prefetchPRNG);
+				if (not copName) return; // should never happen
+
+				this->prefetchedNames[(this->numPrefetchedNames)++] = copName;
+				--(this->numConsumedNames);
+			}
+
+			this->numConsumedNames = 0;
 		}
 
 
 		[[nodiscard]] const char* GetNameOfAvailableCop() const
 		{
-			return this->table.GetNameOfAvailableCop();
+			if (this->numConsumedNames < prefetchSize)
+				++(this->numConsumedNames);
+
+			if (this->numPrefetchedNames > 0)
+				return this->prefetchedNames[--(this->numPrefetchedNames)];
+
+			return this->table->GetNameOfAvailableCop(this->typeToNumActive, this->currentTotalCopChance, prefetchPRNG);
 		}
 
 
 		[[nodiscard]] const char* GetNameOfAvailableCopWithFallback() const
 		{
-			const char* const copName = this->table.GetNameOfAvailableCop();
+			const char* const copName = this->GetNameOfAvailableCop();
 			return (copName) ? copName : this->source->current->GetNameOfAvailableCop();
 		}
 	};
@@ -337,6 +390,19 @@ namespace CopSpawnOverrides
 
 		Contingent chaserSpawns{CopSpawnTables::chaserSpawnTable, this->pursuit};
 
+		// Mod-owned part of the spawn decision (valid for one game tick at most)
+		mutable bool     areSpawnLimitsValid = false;
+		mutable bool     withinSpawnLimits   = false; // cops available and below max. limit
+		mutable bool     belowMinChasers     = false;
+		mutable bool     belowMaxPatrolCars  = false;
+		mutable uint32_t spawnLimitsTick     = 0;
+
+		// Spawn-decision statistics (logging only)
+		mutable uint32_t numSpawnQueries = 0;
+		mutable uint32_t numCachedLimits = 0;
+		mutable uint32_t numQueriedTicks = 0;
+		mutable uint32_t lastQueriedTick = 0;
+
 		inline static constexpr LogLiteral name = "ChasersManager";
 
 
@@ -358,7 +424,7 @@ namespace CopSpawnOverrides
 
 		void UpdateNumPatrolCars()
 		{
-			const address attribute = Globals::GetFromPursuitlevel(this->pursuit, "NumPatrolCars"_vlt);
+			const address attribute = LookupCaches::GetFromPursuitlevel(this->pursuit, "NumPatrolCars"_vlt);
 			this->maxNumPatrolCars  = (attribute) ? AsReference<int>(attribute) : 1; // should never fail
 
 			if constexpr (Globals::loggingEnabled)
@@ -405,25 +471,61 @@ namespace CopSpawnOverrides
 		}
 
 
+		void EvaluateSpawnLimits() const
+		{
+			const int numActiveChasers  = this->chaserSpawns.GetNumTotalActiveCops();
+			const int numActiveVehicles = (chasersAreIndependent.current) ? numActiveChasers : this->GetNumTotalMobileCops();
+
+			this->withinSpawnLimits = (this->chaserSpawns.IsAnyCopAvailable() and (numActiveVehicles < activeChaserLimit.max.current));
+
+			this->belowMinChasers    = (numActiveChasers < activeChaserLimit.min.current);
+			this->belowMaxPatrolCars = (numActiveChasers < this->maxNumPatrolCars);
+
+			this->spawnLimitsTick     = Globals::numGameTicks;
+			this->areSpawnLimitsValid = true;
+		}
+
+
+		void InvalidateSpawnLimits()
+		{
+			this->areSpawnLimitsValid = false;
+		}
+
+
 		[[nodiscard]] bool MayNewChaserSpawn() const
 		{
+			const uint32_t currentTick = Globals::numGameTicks;
+
+			if constexpr (Globals::loggingEnabled)
+			{
+				++(this->numSpawnQueries);
+
+				if ((this->numQueriedTicks == 0) or (this->lastQueriedTick != currentTick))
+				{
+					++(this->numQueriedTicks);
+					this->lastQueriedTick = currentTick;
+				}
+			}
+
 			if (not Globals::playerHeatLevelKnown) return false;
 
-			if (this->isPerpBusted)           return false;
-			if (this->bailingPursuit)         return false;
-			if (this->copSpawnCooldown > 0.f) return false;
+			if (not (this->areSpawnLimitsValid and (this->spawnLimitsTick == currentTick)))
+				this->EvaluateSpawnLimits();
 
-			if (not this->chaserSpawns.IsAnyCopAvailable()) return false;
+			else if constexpr (Globals::loggingEnabled)
+				++(this->numCachedLimits);
 
-			const int numActiveChasers  = this->chaserSpawns.GetNumTotalActiveCops();
-			const int numActiveVehicles = (chasersAreIndependent.current) ? numActiveChasers : this->GetNumTotalMobileCops();
+			if (not this->withinSpawnLimits) return false;
 
-			if (numActiveVehicles >= activeChaserLimit.max.current) return false;
+			// Game-owned fields; these can change between queries within the same tick
+			if (this->isPerpBusted)           return false;
+			if (this->bailingPursuit)         return false;
+			if (this->copSpawnCooldown > 0.f) return false;
 
 			if (Globals::IsPursuitInCooldownMode(this->pursuit))
-				return (numActiveChasers < this->maxNumPatrolCars);
+				return this->belowMaxPatrolCars;
 
-			return ((numActiveChasers < activeChaserLimit.min.current) or (this->GetWaveCapacity() > 0));
+			return (this->belowMinChasers or (this->GetWaveCapacity() > 0));
 		}
 
 
@@ -459,9 +561,9 @@ namespace CopSpawnOverrides
 		}
 
 
-		void ProcessAddedChaser(const address copVehicle)
+		void ProcessAddedChaser(const TypeIndex copTypeIndex)
 		{
-			this->chaserSpawns.AddVehicle(copVehicle);
+			this->chaserSpawns.AddVehicleByIndex(copTypeIndex);
 			this->CorrectWaveCapacity();
 		}
 
@@ -521,9 +623,12 @@ namespace CopSpawnOverrides
 		}
 
 
-		void ProcessRemovedChaser(const address copVehicle)
-		{
-			if (not this->chaserSpawns.RemoveVehicle(copVehicle))
+		void ProcessRemovedChaser
+		(
+			const address   copVehicle,
+			const TypeIndex copTypeIndex
+		) {
+			if (not this->chaserSpawns.RemoveVehicleByIndex(copTypeIndex))
 			{
 				if constexpr (Globals::loggingEnabled)
 					Globals::LogError(logTag, "Unknown chaser", copVehicle, "in", this->pursuit);
@@ -570,26 +675,41 @@ namespace CopSpawnOverrides
 		{
 			if constexpr (Globals::loggingEnabled)
 				Globals::LogPlain('+', this, this->name);
-
-			this->chaserSpawns.ReserveCapacity(20);
 		}
 
 
 		~ChasersManager() override
 		{
 			if constexpr (Globals::loggingEnabled)
+			{
+				if (this->numSpawnQueries > 0)
+				{
+					Globals::LogFull(this->pursuit, logTag, "Spawn queries:", LogDec(this->numSpawnQueries), "in", LogDec(this->numQueriedTicks), "ticks");
+					Globals::LogFull(this->pursuit, logTag, "Cached limits:", LogDec(this->numCachedLimits));
+				}
+
 				Globals::LogPlain('-', this, this->name);
+			}
+		}
+
+
+		void ReactToGameplay() override
+		{
+			if (Globals::playerHeatLevelKnown)
+				this->chaserSpawns.PrefetchNames();
 		}
 
 
 		void ReactToHeatStateUpdate() override 
 		{
+			this->InvalidateSpawnLimits();
 			this->UpdateSpawnTable();
 		}
 
 
 		void ReactToHeatStateUpdateWithDelay() override
 		{
+			this->InvalidateSpawnLimits();
 			this->UpdateNumPatrolCars();
 
 			if (transitionTriggersBackup.current)
@@ -599,13 +719,16 @@ namespace CopSpawnOverrides
 
 		void ReactToAddedVehicle
 		(
-			const address  copVehicle,
-			const CopLabel copLabel
+			const address   copVehicle,
+			const CopLabel  copLabel,
+			const TypeIndex copTypeIndex
 		) 
 			override
 		{
+			this->InvalidateSpawnLimits();
+
 			if (copLabel == CopLabel::CHASER)
-				this->ProcessAddedChaser(copVehicle);
+				this->ProcessAddedChaser(copTypeIndex);
 
 			else this->ProcessNonChaserChange(copLabel, /* change = */ +1);
 		}
@@ -613,13 +736,16 @@ namespace CopSpawnOverrides
 
 		void ReactToRemovedVehicle
 		(
-			const address  copVehicle,
-			const CopLabel copLabel
+			const address   copVehicle,
+			const CopLabel  copLabel,
+			const TypeIndex copTypeIndex
 		) 
 			override
 		{
+			this->InvalidateSpawnLimits();
+
 			if (copLabel == CopLabel::CHASER)
-				this->ProcessRemovedChaser(copVehicle);
+				this->ProcessRemovedChaser(copVehicle, copTypeIndex);
 
 			else this->ProcessNonChaserChange(copLabel, /* change = */ -1);
 		}
@@ -637,6 +763,7 @@ namespace CopSpawnOverrides
 			}
 
 			manager->waveParametersKnown = true;
+			manager->InvalidateSpawnLimits();
 
 			manager->fullWaveCapacity       += manager->numTrackedNonChasers;
 			manager->numCopsToTriggerBackup += manager->numTrackedNonChasers;
@@ -1240,9 +1367,9 @@ namespace CopSpawnOverrides
 		HeatParameters::Parse(parser, "Joining:Limit", roadblockJoinLimit);
 
 		// Container pre-allocations
-		patrolSpawns   .ReserveCapacity(20);
-		scriptedSpawns .ReserveCapacity(10);
-		roadblockSpawns.ReserveCapacity(10);
+		patrolSpawns   .ResizeTypeCounts();
+		scriptedSpawns .ResizeTypeCounts();
+		roadblockSpawns.ResizeTypeCounts();
 
 		// Code modifications 
 		MemoryTools::Write<byte>(0x00, {0x433CB2}); // min. displayed count
@@ -1316,6 +1443,19 @@ namespace CopSpawnOverrides
 
 
 
+	void UpdateFeatureState()
+	{
+		if (not anyFeatureEnabled)             return;
+		if (not Globals::playerHeatLevelKnown) return;
+
+		// Vehicle contingents
+		patrolSpawns   .PrefetchNames();
+		scriptedSpawns .PrefetchNames();
+		roadblockSpawns.PrefetchNames();
+	}
+
+
+
 	void SoftResetFeatureState()
 	{
 		if (not anyFeatureEnabled) return;
@@ -1,12 +1,14 @@
 #pragma once
 
+#include <span>
 #include <array>
 #include <vector>
 #include <utility>
+#include <optional>
 #include <string_view>
 
 #include "../../Common/Globals.hpp"
-#include "../../Common/ModContainers.hpp"
+#include "../../Common/TypeIndices.hpp"
 #include "../../Common/HeatParameters.hpp"
 #include "../../Common/PersistentStrings.hpp"
 
@@ -30,47 +32,57 @@ namespace CopSpawnTables
 
 	class SpawnTable
 	{
-	private: // types
+	public: // aliases
+
+		using TypeIndex = TypeIndices::TypeIndex;
+
+
+	public: // types
 
 		struct CopEntry
 		{
 		// Members
 
+			TypeIndex   typeIndex;
 			const char* copName; // C-style for game compatibility
 
-			int numActive;
 			int maxCount;
-
 			int chance; // relative
 
 
 		// Methods
 
-			[[nodiscard]] int GetNumAvailable() const
-			{
-				return this->maxCount - this->numActive;
-			}
-
-
-			[[nodiscard]] bool IsAvailable() const
+			[[nodiscard]] bool IsAvailable(const int numActive) const
 			{
-				return (this->GetNumAvailable() > 0);
+				return (numActive < this->maxCount);
 			}
 		};
 
 
 	private: // members
 
-		int currentTotalCopChance = 0;
+		int totalCopChance = 0;
 
-		ModContainers::VaultMap<CopEntry> copTypeToEntry;
+		std::vector<CopEntry> copEntries;       // immutable after parsing; shared by all contingents
+		std::vector<size_t>   indexToEntryRank; // dense; entry ID + 1, or 0 if type isn't in table
 
 
 	public: // methods
 
+		[[nodiscard]] std::optional<size_t> FindEntryID(const TypeIndex typeIndex) const
+		{
+			if (typeIndex >= this->indexToEntryRank.size()) return std::nullopt;
+
+			const size_t entryRank = this->indexToEntryRank[typeIndex];
+			if (entryRank == 0) return std::nullopt;
+
+			return entryRank - 1;
+		}
+
+
 		[[nodiscard]] bool ContainsCopType(const vault copType) const
 		{
-			return this->copTypeToEntry.contains(copType);
+			return this->FindEntryID(TypeIndices::GetIndex(copType)).has_value();
 		}
 
 
@@ -85,46 +97,50 @@ namespace CopSpawnTables
 
 			PersistentStrings::Make(copType, copName);
 
-			const auto [pairIt, isNewType] = this->copTypeToEntry.try_emplace
-			(
-				copType, 
-				copName,
-				/* numActive = */ 0,  
-				copCount,
-				copChance
-			);
+			const TypeIndex typeIndex = TypeIndices::Register(copType);
+			if (this->FindEntryID(typeIndex)) return false;
 
-			if (isNewType and (copCount > 0))
-				this->currentTotalCopChance += copChance;
+			if (typeIndex >= this->indexToEntryRank.size())
+				this->indexToEntryRank.resize(typeIndex + 1, 0);
 
-			return isNewType;
+			this->copEntries.emplace_back(typeIndex, copName, copCount, copChance);
+			this->indexToEntryRank[typeIndex] = this->copEntries.size();
+
+			if (copCount > 0)
+				this->totalCopChance += copChance;
+
+			return true;
 		}
 
 
 		[[nodiscard]] size_t GetNumCopEntries() const
 		{
-			return this->copTypeToEntry.size();
+			return this->copEntries.size();
 		}
 
 
 		[[nodiscard]] bool IsEmpty() const
 		{
-			return this->copTypeToEntry.empty();
+			return this->copEntries.empty();
 		}
 
 
-		[[nodiscard]] bool IsAnyCopAvailable() const
+		[[nodiscard]] const CopEntry& GetCopEntry(const size_t entryID) const
 		{
-			return (this->currentTotalCopChance > 0);
+			return this->copEntries[entryID];
 		}
 
 
-		[[nodiscard]] int GetMaxCopCount(const vault copType) const
+		[[nodiscard]] int GetTotalCopChance() const
 		{
-			const auto foundType = this->copTypeToEntry.find(copType);
-			if (foundType == this->copTypeToEntry.end()) return 0;
+			return this->totalCopChance;
+		}
+
 
-			return foundType->second.maxCount;
+		[[nodiscard]] int GetMaxCopCount(const vault copType) const
+		{
+			const auto entryID = this->FindEntryID(TypeIndices::GetIndex(copType));
+			return (entryID) ? this->copEntries[*entryID].maxCount : 0;
 		}
 
 
@@ -132,70 +148,33 @@ namespace CopSpawnTables
 		{
 			int totalCopCount = 0;
 
-			for (const auto& [copType, copEntry] : this->copTypeToEntry)
+			for (const CopEntry& copEntry : this->copEntries)
 				totalCopCount += copEntry.maxCount;
 
 			return totalCopCount;
 		}
 
 
-		[[nodiscard]] int GetNumAvailableCops(const vault copType) const
-		{
-			const auto foundType = this->copTypeToEntry.find(copType);
-			if (foundType == this->copTypeToEntry.end()) return 0;
-
-			return foundType->second.GetNumAvailable();
-		}
-
-
-		bool ChangeNumActiveCops
+		// Active counts are indexed by vehicle type; missing counts are treated as zero
+		[[nodiscard]] const char* GetNameOfAvailableCop
 		(
-			const vault copType,
-			const int   change
-		) {
-			const auto foundType = this->copTypeToEntry.find(copType);
-			if (foundType == this->copTypeToEntry.end()) return false;
-
-			CopEntry&  copEntry     = foundType->second;
-			const bool wasAvailable = copEntry.IsAvailable();
-
-			copEntry.numActive += change;
-
-			if constexpr (Globals::loggingEnabled)
-			{
-				if (copEntry.numActive < 0)
-					Globals::LogError(logTag, "Negative active count for", copEntry.copName);
-			}
-
-			if (wasAvailable != copEntry.IsAvailable())
-				this->currentTotalCopChance += (wasAvailable) ? -copEntry.chance : copEntry.chance;
-
-			return true;
-		}
-
-
-		void ResetActiveCopCounts()
+			const std::span<const int>  typeToNumActive,
+			const int                   availableCopChance,
+			RandomNumbers::Generator<>& prng = Globals::prng
+		) 
+			const
 		{
-			this->currentTotalCopChance = 0;
-
-			for (auto& [copType, copEntry] : this->copTypeToEntry)
-			{
-				copEntry.numActive           = 0;
-				this->currentTotalCopChance += copEntry.chance;
-			}
-		}
-
-
-		[[nodiscard]] const char* GetNameOfAvailableCop() const
-		{
-			if (not this->IsAnyCopAvailable()) return nullptr;
+			if (availableCopChance < 1) return nullptr;
 
 			int       cumulativeChance = 0;
-			const int chanceThreshold  = Globals::prng.GenerateNumber<int>(1, this->currentTotalCopChance);
+			const int chanceThreshold  = prng.GenerateNumber<int>(1, availableCopChance);
 
-			for (const auto& [copType, copEntry] : this->copTypeToEntry)
+			for (const CopEntry& copEntry : this->copEntries)
 			{
-				if (not copEntry.IsAvailable()) continue;
+				const size_t typeIndex = copEntry.typeIndex;
+				const int    numActive = (typeIndex < typeToNumActive.size()) ? typeToNumActive[typeIndex] : 0;
+
+				if (not copEntry.IsAvailable(numActive)) continue;
 
 				cumulativeChance += copEntry.chance;
 
@@ -210,11 +189,17 @@ namespace CopSpawnTables
 		}
 
 
+		[[nodiscard]] const char* GetNameOfAvailableCop() const
+		{
+			return this->GetNameOfAvailableCop({}, this->totalCopChance);
+		}
+
+
 		void Log(const LogLiteral header) const
 		{
 			Globals::LogPlain(HeatParameters::buffer.Format(HeatParameters::nameFormat, header.GetView()), this->GetTotalMaxCopCount());
 
-			for (const auto& [copType, copEntry] : this->copTypeToEntry)
+			for (const CopEntry& copEntry : this->copEntries)
 				Globals::LogDetail(copEntry.copName, copEntry.maxCount, '/', copEntry.chance);
 		}
 	};
@@ -166,29 +166,29 @@ namespace HeatChangeOverrides
 
 		static void NotifyOfTaggedCop
 		(
-			const address copVehicle, 
-			const address perpVehicle
+			const TypeIndex copTypeIndex,
+			const address   perpVehicle
 		) {
 			const address pursuit = Globals    ::GetPursuitOfPerpVehicle(perpVehicle);
 			auto* const   manager = HeatManager::FindInstance           (pursuit);
 			if (not manager) return; // should never happen
 
-			const float heatChange = heatInteractions.GetTaggingChange(copVehicle);
+			const float heatChange = heatInteractions.GetTaggingChange(copTypeIndex);
 			manager->AddToPendingHeatChange(heatChange);
 		}
 
 
 		static void NotifyOfAssaultedCop
 		(
-			const address copVehicle,
-			const address perpVehicle,
-			const byte    numCopAssaulted
+			const TypeIndex copTypeIndex,
+			const address   perpVehicle,
+			const byte      numCopAssaulted
 		) {
 			const address pursuit = Globals    ::GetPursuitOfPerpVehicle(perpVehicle);
 			auto* const   manager = HeatManager::FindInstance           (pursuit);
 			if (not manager) return; // should never happen
 
-			const float heatChange = heatInteractions.GetAssaultChange(copVehicle, numCopAssaulted);
+			const float heatChange = heatInteractions.GetAssaultChange(copTypeIndex, numCopAssaulted);
 			manager->AddToPendingHeatChange(heatChange);
 		}
 
@@ -208,13 +208,13 @@ namespace HeatChangeOverrides
 
 		static void NotifyOfDestroyedCop
 		(
-			const address pursuit,
-			const address copVehicle
+			const address   pursuit,
+			const TypeIndex copTypeIndex
 		) {
 			auto* const manager = HeatManager::FindInstance(pursuit);
 			if (not manager) return; // should never happen
 
-			const float heatChange = heatInteractions.GetWreckingChange(copVehicle);
+			const float heatChange = heatInteractions.GetWreckingChange(copTypeIndex);
 			manager->AddToPendingHeatChange(heatChange);
 		}
 
@@ -539,36 +539,36 @@ namespace HeatChangeOverrides
 
 	void NotifyOfTaggedCop
 	(
-		const address copVehicle, 
-		const address perpVehicle
+		const TypeIndices::TypeIndex copTypeIndex,
+		const address                perpVehicle
 	) {
 		if (not anyFeatureEnabled) return;
 
-		HeatManager::NotifyOfTaggedCop(copVehicle, perpVehicle);
+		HeatManager::NotifyOfTaggedCop(copTypeIndex, perpVehicle);
 	}
 
 
 
 	void NotifyOfAssaultedCop
 	(
-		const address copVehicle,
-		const address perpVehicle,
-		const byte    numCopAssaulted
+		const TypeIndices::TypeIndex copTypeIndex,
+		const address                perpVehicle,
+		const byte                   numCopAssaulted
 	) {
 		if (not anyFeatureEnabled) return;
 
-		HeatManager::NotifyOfAssaultedCop(copVehicle, perpVehicle, numCopAssaulted);
+		HeatManager::NotifyOfAssaultedCop(copTypeIndex, perpVehicle, numCopAssaulted);
 	}
 
 
 
 	void NotifyOfDestroyedCop
 	(
-		const address pursuit, 
-		const address copVehicle
+		const address                pursuit,
+		const TypeIndices::TypeIndex copTypeIndex
 	) {
 		if (not anyFeatureEnabled) return;
 
-		HeatManager::NotifyOfDestroyedCop(pursuit, copVehicle);
+		HeatManager::NotifyOfDestroyedCop(pursuit, copTypeIndex);
 	}
 }
\ No newline at end of file
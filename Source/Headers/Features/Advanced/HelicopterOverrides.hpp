@@ -4,6 +4,7 @@
 #include <algorithm>
 
 #include "../../Common/Globals.hpp"
+#include "../../Common/LookupCaches.hpp"
 #include "../../Common/HeatParameters.hpp"
 #include "../../Common/PersistentStrings.hpp"
 
@@ -394,6 +395,12 @@ namespace HelicopterOverrides
 		}
 
 
+		[[nodiscard]] static bool TracksCopLabel(const CopLabel copLabel)
+		{
+			return (copLabel == CopLabel::HELICOPTER);
+		}
+
+
 		void ReactToGameplay() override 
 		{
 			this->MakeSpawnAttempt();
@@ -415,13 +422,12 @@ namespace HelicopterOverrides
 
 		void ReactToAddedVehicle
 		(
-			const address  copVehicle,
-			const CopLabel copLabel
+			const address   copVehicle,
+			const CopLabel  copLabel,
+			const TypeIndex copTypeIndex
 		) 
 			override
 		{
-			if (copLabel != CopLabel::HELICOPTER) return;
-
 			this->spawnTimer.Stop();
 
 			if (this->IsHelicopterRejoining() and this->IsOwner())
@@ -449,13 +455,12 @@ namespace HelicopterOverrides
 
 		void ReactToRemovedVehicle
 		(
-			const address  copVehicle,
-			const CopLabel copLabel
+			const address   copVehicle,
+			const CopLabel  copLabel,
+			const TypeIndex copTypeIndex
 		) 
 			override
 		{
-			if (copLabel != CopLabel::HELICOPTER) return;
-
 			Status newStatus = Status::LOST;
 
 			if (Globals::IsVehicleDestroyed(copVehicle))
@@ -496,7 +501,7 @@ namespace HelicopterOverrides
 
 	[[nodiscard]] bool __fastcall IsSearchSpawnAllowed(const address pursuit)
 	{
-		const address attribute   = Globals::GetFromPursuitlevel(pursuit, "SearchModeHeliSpawnChance"_vlt);
+		const address attribute   = LookupCaches::GetFromPursuitlevel(pursuit, "SearchModeHeliSpawnChance"_vlt);
 		const float   spawnChance = (attribute) ? AsReference<float>(attribute) : 0.f; // should never fail
 		const bool    isAllowed   = Globals::prng.DoPercentTrial<float>(spawnChance);
 
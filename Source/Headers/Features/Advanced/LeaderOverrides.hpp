@@ -372,6 +372,12 @@ namespace LeaderOverrides
 		}
 
 
+		[[nodiscard]] static bool TracksCopLabel(const CopLabel copLabel)
+		{
+			return (copLabel == CopLabel::LEADER);
+		}
+
+
 		void ReactToGameplay() override
 		{
 			this->CheckAggroTimers   ();
@@ -388,13 +394,12 @@ namespace LeaderOverrides
 
 		void ReactToAddedVehicle
 		(
-			const address  copVehicle,
-			const CopLabel copLabel
+			const address   copVehicle,
+			const CopLabel  copLabel,
+			const TypeIndex copTypeIndex
 		)
 			override
 		{
-			if (copLabel != CopLabel::LEADER) return;
-
 			if (not this->crossVehicle) // Cross always joins first
 				this->ProcessAddedCross(copVehicle);
 
@@ -404,13 +409,12 @@ namespace LeaderOverrides
 
 		void ReactToRemovedVehicle
 		(
-			const address  copVehicle,
-			const CopLabel copLabel
+			const address   copVehicle,
+			const CopLabel  copLabel,
+			const TypeIndex copTypeIndex
 		)
 			override
 		{
-			if (copLabel != CopLabel::LEADER) return;
-
 			if (this->crossVehicle == copVehicle)
 				this->ProcessRemovedCross(copVehicle);
 
@@ -1,9 +1,12 @@
 #pragma once
 
 #include <span>
+#include <limits>
 #include <concepts>
+#include <type_traits>
 
 #include "../../Common/Globals.hpp"
+#include "../../Common/TypeIndices.hpp"
 #include "../../Common/ModContainers.hpp"
 #include "../../Common/HeatParameters.hpp"
 
@@ -25,6 +28,11 @@ namespace PursuitFeatures
 
 	class Reaction
 	{
+	public: // aliases
+
+		using TypeIndex = TypeIndices::TypeIndex;
+
+
 	public: // types
 
 		enum class CopLabel
@@ -60,6 +68,13 @@ namespace PursuitFeatures
 		virtual ~Reaction() = default;
 
 
+		// Vehicle events only reach reactions that track the vehicle's label
+		[[nodiscard]] static bool TracksCopLabel(const CopLabel copLabel)
+		{
+			return true;
+		}
+
+
 		virtual void ReactToGameplay                () {}
 		virtual void ReactToHeatStateUpdate         () {}
 		virtual void ReactToPursuitStartWithDelay   () {}
@@ -68,14 +83,16 @@ namespace PursuitFeatures
 
 		virtual void ReactToAddedVehicle
 		(
-			const address  copVehicle,
-			const CopLabel copLabel
+			const address   copVehicle,
+			const CopLabel  copLabel,
+			const TypeIndex copTypeIndex
 		) {};
 
 		virtual void ReactToRemovedVehicle
 		(
-			const address  copVehicle,
-			const CopLabel copLabel
+			const address   copVehicle,
+			const CopLabel  copLabel,
+			const TypeIndex copTypeIndex
 		) {};
 
 
@@ -89,6 +106,30 @@ namespace PursuitFeatures
 
 
 
+	// Reaction events ------------------------------------------------------------------------------------------------------------------------------
+
+	namespace Details
+	{
+		template <typename MemberPointer>
+		struct MemberClass;
+
+
+		template <typename Member, class Class>
+		struct MemberClass<Member Class::*>
+		{
+			using type = Class;
+		};
+	}
+
+
+	// True iff the member function is declared by a derived reaction, i.e. it is an override of an event handler
+	template <auto memberFunction>
+	constexpr bool isOverridden = (not std::is_same_v<typename Details::MemberClass<decltype(memberFunction)>::type, Reaction>);
+
+
+
+
+
 	// Searchable class -----------------------------------------------------------------------------------------------------------------------------
 
 	template <class Feature>
@@ -98,6 +139,8 @@ namespace PursuitFeatures
 
 		inline static RELEASE_CONSTINIT ModContainers::Set<Feature*> instances;
 
+		inline static Feature* lastFoundInstance = nullptr; // consecutive lookups mostly concern the same pursuit
+
 
 	protected: // methods
 
@@ -135,6 +178,9 @@ namespace PursuitFeatures
 			const auto* const instance      = static_cast<const Feature*>(this);
 			const bool        wasRegistered = this->instances.erase(instance);
 
+			if (this->lastFoundInstance == instance)
+				this->lastFoundInstance = nullptr;
+
 			if constexpr (Globals::loggingEnabled)
 			{
 				if (not wasRegistered)
@@ -145,8 +191,11 @@ namespace PursuitFeatures
 
 		[[nodiscard]] static Feature* FindInstance(const address pursuit)
 		{
+			if (Searchable::lastFoundInstance and (Searchable::lastFoundInstance->GetPursuit() == pursuit))
+				return Searchable::lastFoundInstance;
+
 			for (auto* const instance : Searchable::instances)
-				if (instance->GetPursuit() == pursuit) return instance;
+				if (instance->GetPursuit() == pursuit) return (Searchable::lastFoundInstance = instance);
 
 			if constexpr (Globals::loggingEnabled)
 				Globals::LogError(logTag, "Lookup failed:", pursuit);
@@ -180,13 +229,23 @@ namespace PursuitFeatures
 		float startTimestamp = 0.f;
 		float endTimestamp   = 0.f;
 
+		float deadline = std::numeric_limits<float>::infinity(); // end timestamp while set and enabled
+
 
 	private: // methods
 
+		void UpdateDeadline()
+		{
+			this->deadline = (this->isSet and this->isEnabled) ? this->endTimestamp : std::numeric_limits<float>::infinity();
+		}
+
+
 		void UpdateLength()
 		{
 			this->length       = Globals::prng.GenerateNumber<float>(this->minLength, this->maxLength);
 			this->endTimestamp = this->startTimestamp + this->length;
+
+			this->UpdateDeadline();
 		}
 
 
@@ -217,6 +276,7 @@ namespace PursuitFeatures
 			if (not this->isSet) return false;
 
 			this->isSet = false;
+			this->UpdateDeadline();
 
 			return true;
 		}
@@ -225,6 +285,7 @@ namespace PursuitFeatures
 		void DisableInterval()
 		{
 			this->isEnabled = false;
+			this->UpdateDeadline();
 		}
 
 
@@ -235,7 +296,12 @@ namespace PursuitFeatures
 			const float maxLength
 		) {
 			this->isEnabled = isEnabled;
-			if (not this->isEnabled) return;
+
+			if (not this->isEnabled)
+			{
+				this->UpdateDeadline();
+				return;
+			}
 
 			this->minLength = minLength;
 			this->maxLength = maxLength;
@@ -286,10 +352,7 @@ namespace PursuitFeatures
 
 		[[nodiscard]] bool HasExpired() const
 		{
-			if (not this->isSet)     return false;
-			if (not this->isEnabled) return false;
-
-			return (this->GetTimeLeft() <= 0.f);
+			return (Globals::simulationTime >= this->deadline); // never while unset or disabled
 		}
 	};
 }
\ No newline at end of file
@@ -1,11 +1,14 @@
 #pragma once
 
+#include <array>
 #include <vector>
 #include <memory>
 #include <utility>
 #include <concepts>
 
 #include "../../Common/Globals.hpp"
+#include "../../Common/TypeIndices.hpp"
+#include "../../Common/LookupCaches.hpp"
 #include "../../Common/ModContainers.hpp"
 #include "../../Common/HeatParameters.hpp"
 
@@ -43,7 +46,33 @@ namespace PursuitObserver
 	{
 	private: // aliases
 
-		using CopLabel = PursuitFeatures::Reaction::CopLabel;
+		using CopLabel  = PursuitFeatures::Reaction::CopLabel;
+		using TypeIndex = PursuitFeatures::Reaction::TypeIndex;
+
+		using Subscribers = std::vector<PursuitFeatures::Reaction*>;
+
+
+	private: // types
+
+		struct CopRecord
+		{
+		// Members
+
+			CopLabel  label;
+			TypeIndex typeIndex;
+		};
+
+
+		struct GameplaySubscriber
+		{
+		// Members
+
+			PursuitFeatures::Reaction* reaction;
+
+			bool reactsToGameplay;
+			bool reactsToPursuitStartWithDelay;
+			bool reactsToHeatStateUpdateWithDelay;
+		};
 
 
 	private: // members
@@ -54,10 +83,18 @@ namespace PursuitObserver
 		bool delayedPursuitUpdatePending   = true;
 		bool delayedHeatStateUpdatePending = true;
 
-		ModContainers::AddressMap<CopLabel> copVehicleToLabel;
+		ModContainers::AddressMap<CopRecord> copVehicleToRecord;
 
 		ModContainers::PointerStorage<PursuitFeatures::Reaction> reactions;
 
+		inline static constexpr size_t numCopLabels = static_cast<size_t>(CopLabel::HELICOPTER) + 1;
+
+		// Only reactions that override an event's handler subscribe to it (and, for vehicles, track its label)
+		std::vector<GameplaySubscriber>       gameplaySubscribers; // in attachment order
+		Subscribers                           heatStateSubscribers;
+		std::array<Subscribers, numCopLabels> labelToAddedSubscribers;
+		std::array<Subscribers, numCopLabels> labelToRemovedSubscribers;
+
 		inline static constexpr LogLiteral name = "PursuitObserver";
 
 
@@ -101,7 +138,31 @@ namespace PursuitObserver
 		{
 			if (not Feature::isEnabled) return;
 
-			this->reactions.EmplaceObject<Feature>(this->pursuit);
+			using PursuitFeatures::isOverridden;
+
+			auto& reaction = this->reactions.EmplaceObject<Feature>(this->pursuit);
+
+			// Gameplay-time handlers share one list, so each reaction still runs all of them before the next one
+			constexpr bool reactsToGameplay                 = isOverridden<&Feature::ReactToGameplay>;
+			constexpr bool reactsToPursuitStartWithDelay    = isOverridden<&Feature::ReactToPursuitStartWithDelay>;
+			constexpr bool reactsToHeatStateUpdateWithDelay = isOverridden<&Feature::ReactToHeatStateUpdateWithDelay>;
+
+			if constexpr (reactsToGameplay or reactsToPursuitStartWithDelay or reactsToHeatStateUpdateWithDelay)
+				this->gameplaySubscribers.push_back({&reaction, reactsToGameplay, reactsToPursuitStartWithDelay, reactsToHeatStateUpdateWithDelay});
+
+			if constexpr (isOverridden<&Feature::ReactToHeatStateUpdate>)
+				this->heatStateSubscribers.push_back(&reaction);
+
+			for (size_t labelID = 0; labelID < this->numCopLabels; ++labelID)
+			{
+				if (not Feature::TracksCopLabel(static_cast<CopLabel>(labelID))) continue;
+
+				if constexpr (isOverridden<&Feature::ReactToAddedVehicle>)
+					this->labelToAddedSubscribers[labelID].push_back(&reaction);
+
+				if constexpr (isOverridden<&Feature::ReactToRemovedVehicle>)
+					this->labelToRemovedSubscribers[labelID].push_back(&reaction);
+			}
 		}
 
 
@@ -113,8 +174,17 @@ namespace PursuitObserver
 				Globals::LogPlain('+', this, this->name);
 
 			// Container pre-allocations
-			this->reactions        .ReserveCapacity(6);
-			this->copVehicleToLabel.reserve        (100);
+			this->reactions         .ReserveCapacity(6);
+			this->copVehicleToRecord.reserve        (100);
+
+			this->gameplaySubscribers .reserve(6);
+			this->heatStateSubscribers.reserve(6);
+
+			for (size_t labelID = 0; labelID < this->numCopLabels; ++labelID)
+			{
+				this->labelToAddedSubscribers  [labelID].reserve(6);
+				this->labelToRemovedSubscribers[labelID].reserve(6);
+			}
 
 			// Reaction features
 			this->AttachReaction<CopSpawnOverrides  ::ChasersManager>   ();
@@ -142,7 +212,7 @@ namespace PursuitObserver
 
 		void ProcessHeatStateUpdate()
 		{
-			for (const auto& reaction : this->reactions)
+			for (auto* const reaction : this->heatStateSubscribers)
 				reaction->ReactToHeatStateUpdate();
 
 			this->delayedHeatStateUpdatePending = true;
@@ -151,18 +221,19 @@ namespace PursuitObserver
 
 		void ProcessGameplay()
 		{
-			for (const auto& reaction : this->reactions)
+			for (const GameplaySubscriber& subscriber : this->gameplaySubscribers)
 			{
 				if (not this->firstGameplayUpdatePending)
 				{
-					if (this->delayedPursuitUpdatePending)
-						reaction->ReactToPursuitStartWithDelay();
+					if (this->delayedPursuitUpdatePending and subscriber.reactsToPursuitStartWithDelay)
+						subscriber.reaction->ReactToPursuitStartWithDelay();
 
-					if (this->delayedHeatStateUpdatePending)
-						reaction->ReactToHeatStateUpdateWithDelay();
+					if (this->delayedHeatStateUpdatePending and subscriber.reactsToHeatStateUpdateWithDelay)
+						subscriber.reaction->ReactToHeatStateUpdateWithDelay();
 				}
 
-				reaction->ReactToGameplay();
+				if (subscriber.reactsToGameplay)
+					subscriber.reaction->ReactToGameplay();
 			}
 
 			if (not this->firstGameplayUpdatePending)
@@ -189,13 +260,14 @@ namespace PursuitObserver
 			auto* const observer = PursuitObserver::FindInstance(pursuit);
 			if (not observer) return; // should never happen
 
-			const CopLabel copLabel               = observer->InferCopLabelFromCaller(caller);
-			const auto     [pairIt, isNewVehicle] = observer->copVehicleToLabel.try_emplace(copVehicle, copLabel);
+			const CopLabel  copLabel               = observer->InferCopLabelFromCaller(caller);
+			const TypeIndex copTypeIndex           = TypeIndices::GetIndexOfVehicle(copVehicle); // resolved once per vehicle
+			const auto      [pairIt, isNewVehicle] = observer->copVehicleToRecord.try_emplace(copVehicle, copLabel, copTypeIndex);
 			
 			if (not isNewVehicle)
 			{
 				if constexpr (Globals::loggingEnabled)
-					Globals::LogError(logTag, '=', copVehicle, copLabel, "is already", pairIt->second);
+					Globals::LogError(logTag, '=', copVehicle, copLabel, "is already", pairIt->second.label);
 
 				return; // should never happen
 			}
@@ -204,8 +276,8 @@ namespace PursuitObserver
 			if constexpr (Globals::loggingEnabled)
 				Globals::LogFull(pursuit, logTag, '+', copVehicle, copLabel, Globals::GetVehicleName(copVehicle));
 
-			for (const auto& reaction : observer->reactions)
-				reaction->ReactToAddedVehicle(copVehicle, copLabel);
+			for (auto* const reaction : observer->labelToAddedSubscribers[static_cast<size_t>(copLabel)])
+				reaction->ReactToAddedVehicle(copVehicle, copLabel, copTypeIndex);
 		}
 
 
@@ -217,9 +289,9 @@ namespace PursuitObserver
 			auto* const observer = PursuitObserver::FindInstance(pursuit);
 			if (not observer) return; // should never happen
 
-			const auto foundVehicle = observer->copVehicleToLabel.find(copVehicle);
+			const auto foundVehicle = observer->copVehicleToRecord.find(copVehicle);
 
-			if (foundVehicle == observer->copVehicleToLabel.end())
+			if (foundVehicle == observer->copVehicleToRecord.end())
 			{
 				if constexpr (Globals::loggingEnabled)
 					Globals::LogError(logTag, "Unknown vehicle", copVehicle, Globals::GetVehicleName(copVehicle), "in", pursuit);
@@ -228,13 +300,17 @@ namespace PursuitObserver
 			}
 
 			// Process known vehicle
+			const CopRecord& copRecord = foundVehicle->second;
+
 			if constexpr (Globals::loggingEnabled)
-				Globals::LogFull(pursuit, logTag, '-', copVehicle, foundVehicle->second, Globals::GetVehicleName(copVehicle));
+				Globals::LogFull(pursuit, logTag, '-', copVehicle, copRecord.label, Globals::GetVehicleName(copVehicle));
 
-			for (const auto& reaction : observer->reactions)
-				reaction->ReactToRemovedVehicle(copVehicle, foundVehicle->second);
+			for (auto* const reaction : observer->labelToRemovedSubscribers[static_cast<size_t>(copRecord.label)])
+				reaction->ReactToRemovedVehicle(copVehicle, copRecord.label, copRecord.typeIndex);
 
-			observer->copVehicleToLabel.erase(foundVehicle);
+			observer->copVehicleToRecord.erase(foundVehicle);
+
+			LookupCaches::NotifyOfRemovedVehicle(copVehicle);
 		}
 	};
 
@@ -269,6 +345,8 @@ namespace PursuitObserver
 			Globals::LogFull("     NEW", logTag, "Pursuit", pursuit);
 
 		observers.EmplaceObject(pursuit);
+
+		Globals::trackedPursuits.emplace_back(pursuit, 0x0); // local player resolved lazily, as targets are unknown yet
 	}
 
 
@@ -300,6 +378,11 @@ namespace PursuitObserver
 
 			observers.EraseObject(it);
 
+			const auto IsPursuit = [=](const std::pair<address, address>& pair) -> bool {return (pair.first == pursuit);};
+			std::erase_if(Globals::trackedPursuits, IsPursuit);
+
+			LookupCaches::NotifyOfDeletedPursuit(pursuit);
+
 			return; // deleted
 		}
 
@@ -439,6 +522,8 @@ namespace PursuitObserver
 		MemoryTools::MakeRangeJMP<pursuitDestructorEntrance,  pursuitDestructorExit> (PursuitDestructor);
 		MemoryTools::MakeRangeJMP<pursuitConstructorEntrance, pursuitConstructorExit>(PursuitConstructor);
 
+		Globals::pursuitsTracked = true;
+
 		// Status flag
 		anyFeatureEnabled = true;
 
@@ -469,6 +554,8 @@ namespace PursuitObserver
 	{
 		if (not anyFeatureEnabled) return;
 
+		CopSpawnOverrides::UpdateFeatureState();
+
 		NotifyOfGameplay();
 	}
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include <string_view>
 
 #include "../../Common/Globals.hpp"
+#include "../../Common/LookupCaches.hpp"
 #include "../../Common/HeatParameters.hpp"
 
 #include "../../Utilities/MemoryTools.hpp"
@@ -61,13 +62,13 @@ namespace RoadblockOverrides
 
 
 
-	// Setup (mod-specific)
+	// Setup (mod-specific; only touched for parsing, Heat transitions and selected setups)
 	struct RBSetup
 	{
 	// Members
 
 		RBTable original;
-		RBTable mirrored;
+		RBTable mirrored; // pre-built, so returned tables stay valid for as long as the game holds them
 
 		bool hasSpikes  = false;
 		bool canStretch = true;
@@ -103,12 +104,6 @@ namespace RoadblockOverrides
 		}
 
 
-		[[nodiscard]] bool IsCompatibleCarCount(const size_t maxNumCars) const
-		{
-			return (this->GetNumCarsRequired() <= maxNumCars);
-		}
-
-
 		[[nodiscard]] const RBTable& GetRandomTable() const
 		{
 			const bool isMirrored = Globals::prng.DoPercentTrial<float>(this->mirrorChance);
@@ -139,6 +134,29 @@ namespace RoadblockOverrides
 
 
 
+	// Candidate (mod-specific; hot copy of selection-relevant setup fields)
+	struct RBCandidate
+	{
+	// Members
+
+		float minRoadWidth = 0.f; // metres
+		float maxRoadWidth = 0.f; // metres
+
+		int chance = 0; // relative
+
+		const RBSetup* setup = nullptr;
+
+
+	// Methods
+
+		[[nodiscard]] bool IsCompatbleRoadWidth(const float roadWidth) const
+		{
+			return ((roadWidth >= this->minRoadWidth) and (roadWidth < this->maxRoadWidth));
+		}
+	};
+
+
+
 
 
 	// Parameters -----------------------------------------------------------------------------------------------------------------------------------
@@ -153,6 +171,8 @@ namespace RoadblockOverrides
 	template <typename T>
 	using PartArray = std::array<T, maxNumParts>;
 
+	using CandidateBucket = std::vector<RBCandidate>; // sorted by minimum road width
+
 	// Heat parameters
 	constinit HEAT_PARAMETER_VALUE(float, spawnCalloutChance, 100.f, {0.f, 100.f}); // percent
 	constinit HEAT_PARAMETER_VALUE(float, spikeCalloutChance, 50.f,  {0.f, 100.f}); // percent
@@ -161,7 +181,10 @@ namespace RoadblockOverrides
 	constexpr std::string_view setupPrefix = "Setups:";
 	
 	// Code caves
-	RELEASE_CONSTINIT std::vector<RBSetup> roadblockSetups;
+	RELEASE_CONSTINIT std::vector<RBSetup> roadblockSetups; // immutable after parsing
+
+	// Available setups, bucketed by spike flag and car count; rebuilt for each Heat state
+	RELEASE_CONSTINIT std::array<PartArray<CandidateBucket>, 2> candidateBuckets;
 
 	size_t numRegularCandidates = 0;
 	size_t numSpikeCandidates   = 0;
@@ -178,21 +201,78 @@ namespace RoadblockOverrides
 
 	// Auxiliary functions --------------------------------------------------------------------------------------------------------------------------
 
+	[[nodiscard]] CandidateBucket& GetCandidateBucket
+	(
+		const bool   hasSpikes,
+		const size_t numCarsRequired
+	) {
+		return candidateBuckets[hasSpikes][numCarsRequired - 1]; // setups always require at least one car
+	}
+
+
+
+	void RebuildCandidateBuckets()
+	{
+		for (auto& bucketArray : candidateBuckets)
+		{
+			for (CandidateBucket& bucket : bucketArray)
+				bucket.clear(); // keeps capacity
+		}
+
+		for (const RBSetup& setup : roadblockSetups)
+		{
+			if (not setup.IsAvailable()) continue;
+
+			const RBCandidate candidate = {setup.original.minRoadWidth, setup.maxRoadWidth, setup.chance.current, &setup};
+			GetCandidateBucket(setup.hasSpikes, setup.GetNumCarsRequired()).push_back(candidate);
+		}
+
+		const auto IsNarrower = [](const RBCandidate& a, const RBCandidate& b) -> bool {return (a.minRoadWidth < b.minRoadWidth);};
+
+		for (auto& bucketArray : candidateBuckets)
+		{
+			for (CandidateBucket& bucket : bucketArray)
+				std::stable_sort(bucket.begin(), bucket.end(), IsNarrower);
+		}
+	}
+
+
+
+	// Returns the end of the bucket range whose minimum road width doesn't exceed the given width
+	[[nodiscard]] auto GetWidthCompatibleEnd
+	(
+		const CandidateBucket& bucket,
+		const float            roadWidth
+	) {
+		const auto IsNarrower = [](const float roadWidth, const RBCandidate& candidate) -> bool {return (roadWidth < candidate.minRoadWidth);};
+		return std::upper_bound(bucket.begin(), bucket.end(), roadWidth, IsNarrower);
+	}
+
+
+
 	[[nodiscard]] void __stdcall GatherSetupMetadata(const float roadWidth)
 	{
 		numRegularCandidates = 0;
 		numSpikeCandidates   = 0;
 		maxNumCarsRequired   = 0;
 
-		for (const RBSetup& setup : roadblockSetups)
+		for (const bool hasSpikes : {false, true})
 		{
-			if (not setup.IsAvailable())                   continue;
-			if (not setup.IsCompatbleRoadWidth(roadWidth)) continue;
+			size_t& numCandidates = (hasSpikes) ? numSpikeCandidates : numRegularCandidates;
+
+			for (size_t numCarsRequired = 1; numCarsRequired <= maxNumParts; ++numCarsRequired)
+			{
+				const CandidateBucket& bucket = GetCandidateBucket(hasSpikes, numCarsRequired);
+				const auto             end    = GetWidthCompatibleEnd(bucket, roadWidth);
 
-			if (setup.hasSpikes) ++numSpikeCandidates;
-			else                 ++numRegularCandidates;
+				for (auto candidate = bucket.begin(); candidate != end; ++candidate)
+				{
+					if (not candidate->IsCompatbleRoadWidth(roadWidth)) continue;
 
-			maxNumCarsRequired = std::max<size_t>(maxNumCarsRequired, setup.GetNumCarsRequired());
+					++numCandidates;
+					maxNumCarsRequired = std::max<size_t>(maxNumCarsRequired, numCarsRequired);
+				}
+			}
 		}
 	}
 
@@ -208,7 +288,7 @@ namespace RoadblockOverrides
 
 		if (Globals::IsPursuitInCooldownMode(pursuit)) return anyRegular;
 
-		const address attribute   = Globals::GetFromPursuitlevel(pursuit, "roadblockspikechance"_vlt);
+		const address attribute   = LookupCaches::GetFromPursuitlevel(pursuit, "roadblockspikechance"_vlt);
 		const float   spikeChance = (attribute) ? AsReference<float>(attribute) : 0.f; // should never fail
 
 		if (spikeChance <= 0.f)   return anyRegular; // always regular
@@ -320,7 +400,7 @@ namespace RoadblockOverrides
 		const size_t maxNumCars, 
 		const bool   needsSpikes
 	) {
-		static RELEASE_CONSTINIT std::vector<const RBSetup*> candidates;
+		static RELEASE_CONSTINIT std::vector<const RBCandidate*> candidates;
 
 		if constexpr (Globals::loggingEnabled)
 		{
@@ -333,16 +413,20 @@ namespace RoadblockOverrides
 		// Find eligible setups
 		int totalChance = 0;
 
-		for (const RBSetup& setup : roadblockSetups)
+		const size_t maxNumCarsUsable = std::min<size_t>(maxNumCars, maxNumParts);
+
+		for (size_t numCarsRequired = 1; numCarsRequired <= maxNumCarsUsable; ++numCarsRequired)
 		{
-			if (setup.hasSpikes != needsSpikes) continue;
+			const CandidateBucket& bucket = GetCandidateBucket(needsSpikes, numCarsRequired);
+			const auto             end    = GetWidthCompatibleEnd(bucket, roadWidth);
 
-			if (not setup.IsAvailable())                    continue;
-			if (not setup.IsCompatbleRoadWidth(roadWidth))  continue;
-			if (not setup.IsCompatibleCarCount(maxNumCars)) continue;
+			for (auto candidate = bucket.begin(); candidate != end; ++candidate)
+			{
+				if (not candidate->IsCompatbleRoadWidth(roadWidth)) continue;
 
-			totalChance += setup.chance.current;
-			candidates.push_back(&setup);
+				totalChance += candidate->chance;
+				candidates.push_back(&(*candidate));
+			}
 		}
 
 		// Check setup count
@@ -361,13 +445,14 @@ namespace RoadblockOverrides
 		if constexpr (Globals::loggingEnabled)
 			Globals::LogPlain(LogDec(candidates.size()), "candidate(s)");
 
-		for (const RBSetup* const setup : candidates)
+		for (const RBCandidate* const candidate : candidates)
 		{
-			cumulativeChance += setup->chance.current;
+			cumulativeChance += candidate->chance;
 			if (cumulativeChance < chanceThreshold) continue;
 			
-			const auto* const table = &(setup->GetRandomTable());
-			maxStretchScale         = setup->GetMaxStretchScale();
+			const RBSetup&    setup = *(candidate->setup);
+			const auto* const table = &(setup.GetRandomTable());
+			maxStretchScale         = setup.GetMaxStretchScale();
 					
 			candidates.clear(); // safe due to immediate return
 
@@ -702,6 +787,8 @@ namespace RoadblockOverrides
 
 		roadblockSetups.shrink_to_fit();
 
+		RebuildCandidateBuckets(); // for requests before any Heat state is known
+
 		return (not roadblockSetups.empty());
 	}
 
@@ -767,6 +854,8 @@ namespace RoadblockOverrides
 		for (RBSetup& setup : roadblockSetups)
 			setup.chance.SetToHeatStateWithoutLog(state);
 
+		RebuildCandidateBuckets();
+
 		if constexpr (Globals::loggingEnabled)
 		{
 			if (roadblockSetups.empty()) return;
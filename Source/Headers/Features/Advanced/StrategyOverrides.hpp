@@ -124,19 +124,6 @@ namespace StrategyOverrides
 		}
 
 
-		[[nodiscard]] static bool IsStrategyCop(const CopLabel copLabel)
-		{
-			switch (copLabel)
-			{
-				case CopLabel::HEAVY:
-				case CopLabel::LEADER:
-					return true;
-			}
-
-			return false;
-		}
-
-
 	public: // members
 
 		inline static constinit const bool& isEnabled = anyFeatureEnabled;
@@ -160,6 +147,19 @@ namespace StrategyOverrides
 		}
 
 
+		[[nodiscard]] static bool TracksCopLabel(const CopLabel copLabel)
+		{
+			switch (copLabel)
+			{
+				case CopLabel::HEAVY:
+				case CopLabel::LEADER:
+					return true;
+			}
+
+			return false;
+		}
+
+
 		void ReactToGameplay() override
 		{
 			this->CheckUnblockTimer();
@@ -180,13 +180,12 @@ namespace StrategyOverrides
 
 		void ReactToAddedVehicle
 		(
-			const address  copVehicle,
-			const CopLabel copLabel
+			const address   copVehicle,
+			const CopLabel  copLabel,
+			const TypeIndex copTypeIndex
 		)
 			override
 		{
-			if (not this->IsStrategyCop(copLabel)) return;
-
 			if (not this->unblockTimer.IsSet())
 			{
 				if constexpr (Globals::loggingEnabled)
@@ -202,12 +201,12 @@ namespace StrategyOverrides
 
 		void ReactToRemovedVehicle
 		(
-			const address  copVehicle,
-			const CopLabel copLabel
+			const address   copVehicle,
+			const CopLabel  copLabel,
+			const TypeIndex copTypeIndex
 		)
 			override
 		{
-			if (not this->IsStrategyCop(copLabel))                     return;
 			if (not this->vehiclesOfCurrentStrategy.erase(copVehicle)) return;
 
 			if (this->vehiclesOfCurrentStrategy.empty())
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <vector>
+#include <cstdint>
 #include <fstream>
 #include <string_view>
 
 #include "../../Common/Globals.hpp"
+#include "../../Common/LookupCaches.hpp"
 #include "../../Common/ModContainers.hpp"
 #include "../../Common/HeatParameters.hpp"
 
@@ -102,6 +104,30 @@ namespace CopDetection
 
 	// Auxiliary functions --------------------------------------------------------------------------------------------------------------------------
 
+	[[nodiscard]] address GetPlayerPosition()
+	{
+		// Each mini-map update checks every cop against the same player position
+		static constinit address  perpVehicleOfPosition = 0x0;
+		static constinit address  playerPosition        = 0x0;
+		static constinit uint32_t tickOfPosition        = 0;
+
+		if ((perpVehicleOfPosition == Globals::playerPerpVehicle) and (tickOfPosition == Globals::numGameTicks))
+			return playerPosition;
+
+		const address playerVehicle = Globals::GetVehicleOfPerpVehicle(Globals::playerPerpVehicle);
+		if (not playerVehicle) return 0x0; // should never happen
+
+		const auto GetVehiclePosition = AsFunction<address __thiscall (address)>(0x688340);
+
+		perpVehicleOfPosition = Globals::playerPerpVehicle;
+		playerPosition        = GetVehiclePosition(playerVehicle);
+		tickOfPosition        = Globals::numGameTicks;
+
+		return playerPosition;
+	}
+
+
+
 	[[nodiscard]] bool __fastcall GetsMiniMapIcon(const address copVehicle)
 	{
 		const address copAIVehicle = Globals::GetAIVehicleOfVehicle(copVehicle);
@@ -122,18 +148,17 @@ namespace CopDetection
 		}
 
 		// Fetch icon-range data for vehicle type
-		const Settings& settings  = copTypeToSettings.GetReference(Globals::GetVehicleType(copVehicle));
+		const Settings& settings  = copTypeToSettings.GetReference(LookupCaches::GetVehicleType(copVehicle));
 		const float     iconRange = (hasBeenInPursuit) ? settings.pursuitIconRange : settings.patrolIconRange;
 
 		if (iconRange <= 0.f) return false;
 
 		// Check distance to player vehicle
-		const address playerVehicle = Globals::GetVehicleOfPerpVehicle(Globals::playerPerpVehicle);
-		if (not playerVehicle) return false; // should never happen
+		const address playerPosition = GetPlayerPosition();
+		if (not playerPosition) return false; // should never happen
 
 		const auto    GetVehiclePosition = AsFunction<address __thiscall (address)>(0x688340);
 		const address copPosition        = GetVehiclePosition(copVehicle);
-		const address playerPosition     = GetVehiclePosition(playerVehicle);
 
 		const auto GetSquaredDistance = AsFunction<float __cdecl (address, address)>(0x401930);
 		if (GetSquaredDistance(copPosition, playerPosition) > iconRange * iconRange) return false;
@@ -147,7 +172,7 @@ namespace CopDetection
 
 	[[nodiscard]] float __fastcall GetRadarRange(const address copVehicle)
 	{
-		return copTypeToSettings.GetReference(Globals::GetVehicleType(copVehicle)).radarRange;
+		return copTypeToSettings.GetReference(LookupCaches::GetVehicleType(copVehicle)).radarRange;
 	}
 
 
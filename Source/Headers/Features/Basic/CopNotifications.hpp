@@ -86,7 +86,7 @@ namespace CopNotifications
 			const auto        GetBinaryString = AsFunction<const char* __fastcall (int, binary)>(0x56BB80);
 			const char* const binaryString    = GetBinaryString(0, Globals::GetBinaryHash(stringOrName));
 
-			return PersistentStrings::Create((binaryString) ? binaryString : stringOrName).c_str();
+			return PersistentStrings::Create((binaryString) ? binaryString : stringOrName);
 		};
 
 		return copTypeToNotificationText.Fill
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../Common/Globals.hpp"
+#include "../../Common/TypeIndices.hpp"
 #include "../../Common/ParameterSets.hpp"
 #include "../../Common/ModContainers.hpp"
 #include "../../Common/HeatParameters.hpp"
@@ -72,27 +73,40 @@ namespace GameBreaker
 	{
 		if (not localPlayer) return false; // should never happen
 
-		for (const address pursuit : ModContainers::PursuitList())
-			if (localPlayer == Globals::GetLocalPlayerOfPursuit(pursuit)) return true;
+		if (not Globals::pursuitsTracked)
+		{
+			for (const address pursuit : ModContainers::PursuitList())
+				if (localPlayer == Globals::GetLocalPlayerOfPursuit(pursuit)) return true;
+
+			return false;
+		}
+
+		for (auto& [pursuit, pursuitPlayer] : Globals::trackedPursuits)
+		{
+			if (not pursuitPlayer) // resolved lazily, as targets are unknown during construction
+				pursuitPlayer = Globals::GetLocalPlayerOfPursuit(pursuit);
+
+			if (localPlayer == pursuitPlayer) return true;
+		}
 
 		return false;
 	}
 
 
 
-	void ProcessTaggedCop(const address copVehicle)
+	void ProcessTaggedCop(const TypeIndices::TypeIndex copTypeIndex)
 	{
-		pendingCollisionBreakerChange += breakerInteractions.GetTaggingChange(copVehicle);
+		pendingCollisionBreakerChange += breakerInteractions.GetTaggingChange(copTypeIndex);
 	}
 
 
 
 	void ProcessAssaultedCop
 	(
-		const address copVehicle,
-		const byte    numCopAssaulted
+		const TypeIndices::TypeIndex copTypeIndex,
+		const byte                   numCopAssaulted
 	) {
-		pendingCollisionBreakerChange += breakerInteractions.GetAssaultChange(copVehicle, numCopAssaulted);
+		pendingCollisionBreakerChange += breakerInteractions.GetAssaultChange(copTypeIndex, numCopAssaulted);
 	}
 
 
@@ -111,10 +125,10 @@ namespace GameBreaker
 
 	void ProcessDestroyedCop
 	(
-		const address pursuit,
-		const address copVehicle
+		const address                pursuit,
+		const TypeIndices::TypeIndex copTypeIndex
 	) {
-		const float breakerChange = breakerInteractions.GetWreckingChange(copVehicle);
+		const float breakerChange = breakerInteractions.GetWreckingChange(copTypeIndex);
 		if (breakerChange == 0.f) return;
 
 		ChargeSpeedbreakerOfTarget(pursuit, breakerChange);
@@ -236,25 +250,25 @@ namespace GameBreaker
 
 	void NotifyOfTaggedCop
 	(
-		const address copVehicle, 
-		const address perpVehicle
+		const TypeIndices::TypeIndex copTypeIndex,
+		const address                perpVehicle
 	) {
 		if (not anyFeatureEnabled) return;
 
-		ProcessTaggedCop(copVehicle);
+		ProcessTaggedCop(copTypeIndex);
 	}
 
 
 
 	void NotifyOfAssaultedCop
 	(
-		const address copVehicle,
-		const address perpVehicle,
-		const byte    numCopAssaulted
+		const TypeIndices::TypeIndex copTypeIndex,
+		const address                perpVehicle,
+		const byte                   numCopAssaulted
 	) {
 		if (not anyFeatureEnabled) return;
 
-		ProcessAssaultedCop(copVehicle, numCopAssaulted);
+		ProcessAssaultedCop(copTypeIndex, numCopAssaulted);
 	}
 
 
@@ -270,11 +284,11 @@ namespace GameBreaker
 
 	void NotifyOfDestroyedCop
 	(
-		const address pursuit, 
-		const address copVehicle
+		const address                pursuit,
+		const TypeIndices::TypeIndex copTypeIndex
 	) {
 		if (not anyFeatureEnabled) return;
 
-		ProcessDestroyedCop(pursuit, copVehicle);
+		ProcessDestroyedCop(pursuit, copTypeIndex);
 	}
 }
\ No newline at end of file
@@ -68,6 +68,24 @@ namespace GroundSuppport
 	// Conversions
 	float rammingSpeedLimit = heavy3SpeedLimit.current / 3.6f; // metres / second
 
+	// Strategy caching (static Strategy data per "pursuitsupport" node)
+	struct CachedStrategy
+	{
+		address strategy   = 0x0;
+		int     strategyID = 0;
+		int     chance     = 0; // percent
+	};
+
+	struct CachedSupportNode
+	{
+		address supportNode = 0x0;
+
+		std::vector<CachedStrategy> heavyStrategies;
+		std::vector<CachedStrategy> leaderStrategies;
+	};
+
+	RELEASE_CONSTINIT std::vector<CachedSupportNode> cachedSupportNodes; // cleared for each Heat state
+
 
 
 
@@ -116,9 +134,8 @@ namespace GroundSuppport
 	[[nodiscard]] bool IsHeavyStrategyAvailable
 	(
 		const address pursuit,
-		const address heavyStrategy
+		const int     strategyID
 	) {
-		const int  strategyID   = AsReference<int>    (heavyStrategy);
 		const bool hasRoadblock = AsReference<address>(pursuit + 0x84);
 
 		switch (strategyID)
@@ -138,13 +155,11 @@ namespace GroundSuppport
 	[[nodiscard]] bool IsLeaderStrategyAvailable
 	(
 		const address pursuit,
-		const address leaderStrategy
+		const int     strategyID
 	) {
 		const int crossFlag = AsReference<int>(pursuit + 0x164);
 		if (crossFlag != 0) return false; // active or blocked
 
-		const int strategyID = AsReference<int>(leaderStrategy);
-
 		switch (strategyID)
 		{
 		case 5: // Cross only
@@ -170,32 +185,72 @@ namespace GroundSuppport
 
 
 
-	template <address CountFunction, address RetrievalFunction, auto IsStrategyAvailable>
-	requires std::predicate<decltype(IsStrategyAvailable), address, address>
-	void MarshalStrategies
+	template <address CountFunction, address RetrievalFunction>
+	void CacheStrategies
 	(
-		const address         pursuit,
-		std::vector<address>& candidates
+		const address                supportNode,
+		std::vector<CachedStrategy>& strategies
 	) {
-		const auto GetSupportNode = AsFunction<address __thiscall (address)>(0x418EE0);
-
-		const address supportNode = GetSupportNode(pursuit - 0x48);
-		if (not supportNode) return; // should never happen
-
 		const auto GetNumStrategies = AsFunction<size_t  __thiscall (address)>        (CountFunction);
 		const auto GetStrategy      = AsFunction<address __thiscall (address, size_t)>(RetrievalFunction);
 
 		const size_t numStrategies = GetNumStrategies(supportNode);
 
+		strategies.reserve(numStrategies);
+
 		for (size_t strategyID = 0; strategyID < numStrategies; ++strategyID)
 		{
 			const address strategy = GetStrategy(supportNode, strategyID);
-			if (not IsStrategyAvailable(pursuit, strategy)) continue;
+			strategies.emplace_back(strategy, AsReference<int>(strategy), AsReference<int>(strategy + 0x4));
+		}
+	}
+
+
+
+	[[nodiscard]] const CachedSupportNode* GetCachedSupportNode(const address pursuit)
+	{
+		const auto GetSupportNode = AsFunction<address __thiscall (address)>(0x418EE0);
 
-			const int chance = AsReference<int>(strategy + 0x4);
+		const address supportNode = GetSupportNode(pursuit - 0x48);
+		if (not supportNode) return nullptr; // should never happen
 
-			if (Globals::prng.DoPercentTrial<int>(chance))
-				candidates.push_back(strategy);
+		for (const CachedSupportNode& cachedNode : cachedSupportNodes)
+		{
+			if (cachedNode.supportNode == supportNode)
+				return &cachedNode;
+		}
+
+		CachedSupportNode& cachedNode = cachedSupportNodes.emplace_back();
+		cachedNode.supportNode        = supportNode;
+
+		CacheStrategies<0x403600, 0x4035E0>(supportNode, cachedNode.heavyStrategies);
+		CacheStrategies<0x403680, 0x403660>(supportNode, cachedNode.leaderStrategies);
+
+		if constexpr (Globals::loggingEnabled)
+		{
+			Globals::LogFull(pursuit, logTag, "Caching Strategies of", supportNode);
+			Globals::LogPlain(LogDec(cachedNode.heavyStrategies.size()), "heavy,", LogDec(cachedNode.leaderStrategies.size()), "leader");
+		}
+
+		return &cachedNode; // valid until next cache change
+	}
+
+
+
+	template <auto IsStrategyAvailable>
+	requires std::predicate<decltype(IsStrategyAvailable), address, int>
+	void MarshalStrategies
+	(
+		const address                      pursuit,
+		const std::vector<CachedStrategy>& strategies,
+		std::vector<address>&              candidates
+	) {
+		for (const CachedStrategy& cachedStrategy : strategies)
+		{
+			if (not IsStrategyAvailable(pursuit, cachedStrategy.strategyID)) continue;
+
+			if (Globals::prng.DoPercentTrial<int>(cachedStrategy.chance))
+				candidates.push_back(cachedStrategy.strategy);
 		}
 	}
 
@@ -234,15 +289,16 @@ namespace GroundSuppport
 		static RELEASE_CONSTINIT std::vector<address> candidates;
 
 		// Marshal all currently eligible Strategies
-		const bool isPlayerPursuit = Globals::IsPlayerPursuit(pursuit);
+		const bool        isPlayerPursuit = Globals::IsPlayerPursuit(pursuit);
+		const auto* const cachedNode      = GetCachedSupportNode(pursuit);
 
-		if (isPlayerPursuit or rivalHeavyEnabled.current)
-			MarshalStrategies<0x403600, 0x4035E0, IsHeavyStrategyAvailable>(pursuit, candidates);
+		if (cachedNode and (isPlayerPursuit or rivalHeavyEnabled.current))
+			MarshalStrategies<IsHeavyStrategyAvailable>(pursuit, cachedNode->heavyStrategies, candidates);
 
 		const size_t numHeavyStrategies = candidates.size();
 
-		if (isPlayerPursuit or rivalLeaderEnabled.current)
-			MarshalStrategies<0x403680, 0x403660, IsLeaderStrategyAvailable>(pursuit, candidates);
+		if (cachedNode and (isPlayerPursuit or rivalLeaderEnabled.current))
+			MarshalStrategies<IsLeaderStrategyAvailable>(pursuit, cachedNode->leaderStrategies, candidates);
 
 		// Check candidate count
 		if (candidates.empty())
@@ -278,23 +334,43 @@ namespace GroundSuppport
 
 
 
-	[[nodiscard]] int GetNumGlobalMobileCops()
+	[[nodiscard]] int CountRoadblockCops()
 	{
-		int numGlobalMobileCops = AsReference<int>(Globals::copManager + 0x94); // cops loaded
-
-		for (const address pursuit : ModContainers::PursuitList())
+		const auto CountCopsOfPursuit = [](const address pursuit) -> int
 		{
 			const address roadblock = AsReference<address>(pursuit + 0x84);
-			if (not roadblock) continue; // no active roadblock
+			if (not roadblock) return 0; // no active roadblock
 
 			const address firstVehicleEntry = AsReference<address>(roadblock + 0xC);
 			const address lastVehicleEntry  = AsReference<address>(roadblock + 0x10);
 
-			if (lastVehicleEntry > firstVehicleEntry)
-				numGlobalMobileCops -= (lastVehicleEntry - firstVehicleEntry) / sizeof(address);
+			if (lastVehicleEntry <= firstVehicleEntry) return 0; // no roadblock cops
+
+			return static_cast<int>((lastVehicleEntry - firstVehicleEntry) / sizeof(address));
+		};
+
+		int numCops = 0;
+
+		if (Globals::pursuitsTracked)
+		{
+			for (const auto& [pursuit, localPlayer] : Globals::trackedPursuits)
+				numCops += CountCopsOfPursuit(pursuit);
+		}
+		else
+		{
+			for (const address pursuit : ModContainers::PursuitList())
+				numCops += CountCopsOfPursuit(pursuit);
 		}
 
-		return numGlobalMobileCops;
+		return numCops;
+	}
+
+
+
+	[[nodiscard]] int GetNumGlobalMobileCops()
+	{
+		const int numCopsLoaded = AsReference<int>(Globals::copManager + 0x94);
+		return numCopsLoaded - CountRoadblockCops();
 	}
 
 
@@ -923,6 +999,8 @@ namespace GroundSuppport
 
 	void SetToHeatState(const HeatParameters::HeatState state)
 	{
+		cachedSupportNodes.clear(); // Strategy selection is a fix, so it also runs without this feature
+
 		if (not anyFeatureEnabled) return;
 
 		if constexpr (Globals::loggingEnabled)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../../Common/Globals.hpp"
+#include "../../Common/TypeIndices.hpp"
 #include "../../Common/ParameterSets.hpp"
 #include "../../Common/HeatParameters.hpp"
 
@@ -74,19 +75,19 @@ namespace NitrousCharge
 
 
 
-	void ProcessTaggedCop(const address copVehicle) 
+	void ProcessTaggedCop(const TypeIndices::TypeIndex copTypeIndex) 
 	{
-		pendingCollisionNitrousChange += nitrousInteractions.GetTaggingChange(copVehicle);
+		pendingCollisionNitrousChange += nitrousInteractions.GetTaggingChange(copTypeIndex);
 	}
 
 
 
 	void ProcessAssaultedCop
 	(
-		const address copVehicle, 
-		const byte    numCopAssaulted
+		const TypeIndices::TypeIndex copTypeIndex,
+		const byte                   numCopAssaulted
 	) {
-		pendingCollisionNitrousChange += nitrousInteractions.GetAssaultChange(copVehicle, numCopAssaulted);
+		pendingCollisionNitrousChange += nitrousInteractions.GetAssaultChange(copTypeIndex, numCopAssaulted);
 	}
 
 
@@ -105,13 +106,13 @@ namespace NitrousCharge
 
 	void ProcessDestroyedCop
 	(
-		const address pursuit,
-		const address copVehicle
+		const address                pursuit,
+		const TypeIndices::TypeIndex copTypeIndex
 	) {
 		const address perpVehicle = Globals::GetPerpVehicleOfPursuit(pursuit);
 		if (not perpVehicle) return; // should never happen
 
-		const float nitrousChange = nitrousInteractions.GetWreckingChange(copVehicle);
+		const float nitrousChange = nitrousInteractions.GetWreckingChange(copTypeIndex);
 		if (nitrousChange == 0.f) return;
 
 		ChargeNitrous(perpVehicle, nitrousChange);
@@ -190,25 +191,25 @@ namespace NitrousCharge
 
 	void NotifyOfTaggedCop
 	(
-		const address copVehicle, 
-		const address perpVehicle
+		const TypeIndices::TypeIndex copTypeIndex,
+		const address                perpVehicle
 	) {
 		if (not anyFeatureEnabled) return;
 
-		ProcessTaggedCop(copVehicle);
+		ProcessTaggedCop(copTypeIndex);
 	}
 
 
 
 	void NotifyOfAssaultedCop
 	(
-		const address copVehicle,
-		const address perpVehicle,
-		const byte    numCopAssaulted
+		const TypeIndices::TypeIndex copTypeIndex,
+		const address                perpVehicle,
+		const byte                   numCopAssaulted
 	) {
 		if (not anyFeatureEnabled) return;
 
-		ProcessAssaultedCop(copVehicle, numCopAssaulted);
+		ProcessAssaultedCop(copTypeIndex, numCopAssaulted);
 	}
 
 
@@ -224,11 +225,11 @@ namespace NitrousCharge
 
 	void NotifyOfDestroyedCop
 	(
-		const address pursuit, 
-		const address copVehicle
+		const address                pursuit,
+		const TypeIndices::TypeIndex copTypeIndex
 	) {
 		if (not anyFeatureEnabled) return;
 
-		ProcessDestroyedCop(pursuit, copVehicle);
+		ProcessDestroyedCop(pursuit, copTypeIndex);
 	}
 }
\ No newline at end of file
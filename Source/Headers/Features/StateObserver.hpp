@@ -4,6 +4,8 @@
 #include <cstdint>
 
 #include "../Common/Globals.hpp"
+#include "../Common/TypeIndices.hpp"
+#include "../Common/LookupCaches.hpp"
 #include "../Common/HeatParameters.hpp"
 
 #include "../Utilities/MemoryTools.hpp"
@@ -34,6 +36,8 @@ namespace StateObserver
 	size_t playerHeatLevel = 0;
 	bool   playerIsRacing  = false;
 
+	uint32_t numCoalescedChanges = 0; // logging only
+
 
 
 
@@ -55,6 +59,9 @@ namespace StateObserver
 		// Update Heat-level flag
 		Globals::playerHeatLevelKnown = true;
 
+		// Expire cached game lookups
+		LookupCaches::NotifyOfHeatStateUpdate();
+
 		// Update Heat parameters
 		RadioSpeech    ::SetToHeatState(state);
 		GeneralSettings::SetToHeatState(state);
@@ -67,15 +74,42 @@ namespace StateObserver
 
 
 
+	void __fastcall ProcessPlayerHeatState
+	(
+		const size_t heatLevel,
+		const bool   isRacing
+	) {
+		const bool hasLevelChanged = (heatLevel != playerHeatLevel);
+		const bool hasRaceChanged  = (isRacing  != playerIsRacing);
+
+		if (not (hasLevelChanged or hasRaceChanged)) return;
+
+		if constexpr (Globals::loggingEnabled)
+		{
+			if (hasLevelChanged and hasRaceChanged)
+				Globals::LogTagged(logTag, "Coalesced Heat-state changes:", LogDec(++numCoalescedChanges));
+		}
+
+		// Both changes are applied at once, so the intermediate state is never built
+		playerHeatLevel = heatLevel;
+		playerIsRacing  = isRacing;
+
+		ProcessHeatStateUpdate();
+	}
+
+
+
 	void ProcessTaggedCop
 	(
 		const address copVehicle, 
 		const address perpVehicle
 	) {
-		NitrousCharge::NotifyOfTaggedCop(copVehicle, perpVehicle);
-		GameBreaker  ::NotifyOfTaggedCop(copVehicle, perpVehicle);
+		const TypeIndices::TypeIndex copTypeIndex = TypeIndices::GetIndexOfVehicle(copVehicle); // resolved once for all features
+
+		NitrousCharge::NotifyOfTaggedCop(copTypeIndex, perpVehicle);
+		GameBreaker  ::NotifyOfTaggedCop(copTypeIndex, perpVehicle);
 
-		HeatChangeOverrides::NotifyOfTaggedCop(copVehicle, perpVehicle);
+		HeatChangeOverrides::NotifyOfTaggedCop(copTypeIndex, perpVehicle);
 	}
 
 
@@ -86,10 +120,12 @@ namespace StateObserver
 		const address perpVehicle,
 		const byte    numCopAssaulted
 	) {
-		NitrousCharge::NotifyOfAssaultedCop(copVehicle, perpVehicle, numCopAssaulted);
-		GameBreaker  ::NotifyOfAssaultedCop(copVehicle, perpVehicle, numCopAssaulted);
+		const TypeIndices::TypeIndex copTypeIndex = TypeIndices::GetIndexOfVehicle(copVehicle); // resolved once for all features
 
-		HeatChangeOverrides::NotifyOfAssaultedCop(copVehicle, perpVehicle, numCopAssaulted);
+		NitrousCharge::NotifyOfAssaultedCop(copTypeIndex, perpVehicle, numCopAssaulted);
+		GameBreaker  ::NotifyOfAssaultedCop(copTypeIndex, perpVehicle, numCopAssaulted);
+
+		HeatChangeOverrides::NotifyOfAssaultedCop(copTypeIndex, perpVehicle, numCopAssaulted);
 	}
 
 
@@ -109,10 +145,12 @@ namespace StateObserver
 		const address pursuit,
 		const address copVehicle
 	) {
-		NitrousCharge::NotifyOfDestroyedCop(pursuit, copVehicle);
-		GameBreaker  ::NotifyOfDestroyedCop(pursuit, copVehicle);
+		const TypeIndices::TypeIndex copTypeIndex = TypeIndices::GetIndexOfVehicle(copVehicle); // resolved once for all features
+
+		NitrousCharge::NotifyOfDestroyedCop(pursuit, copTypeIndex);
+		GameBreaker  ::NotifyOfDestroyedCop(pursuit, copTypeIndex);
 
-		HeatChangeOverrides::NotifyOfDestroyedCop(pursuit, copVehicle);
+		HeatChangeOverrides::NotifyOfDestroyedCop(pursuit, copTypeIndex);
 	}
 
 
@@ -377,22 +415,47 @@ namespace StateObserver
 	constexpr address heatLevelObserverEntrance = 0x4090BE;
 	constexpr address heatLevelObserverExit     = 0x4090C6;
 
-	// Triggers on Heat-level changes for the player
+	// Triggers on Heat-level and race-status changes for the player; expires cached pursuit attributes for all racers
 	__declspec(naked) void HeatLevelObserver()
 	{
 		__asm
 		{
-			cmp ebp, dword ptr [playerHeatLevel]
-			je conclusion // Heat unchanged
+			cmp ebp, edi // previous Heat level
+			je player    // Heat unchanged
+
+			push eax
+			push ecx
+			push edx
+
+			mov ecx, esi
+			call LookupCaches::NotifyOfHeatLevelChange // ecx: perpVehicle
 
+			pop edx
+			pop ecx
+			pop eax
+
+			player:
 			cmp esi, dword ptr [Globals::playerPerpVehicle]
 			jne conclusion // not player vehicle
 
 			cmp dword ptr [esp + 0x20], 0x416A75 // caller
 			je conclusion                        // not true Heat
 
-			mov dword ptr [playerHeatLevel], ebp
-			call ProcessHeatStateUpdate
+			cmp ebp, dword ptr [playerHeatLevel]
+			jne update // Heat changed
+
+			test bl, bl // new race status
+			setne al    // overwritten by original code below
+
+			cmp al, byte ptr [playerIsRacing]
+			je conclusion // race status unchanged
+
+			update:
+			test bl, bl
+			setne dl
+
+			mov ecx, ebp
+			call ProcessPlayerHeatState // ecx: heatLevel; dl: isRacing
 
 			conclusion:
 			// Execute original code and resume
@@ -463,6 +526,7 @@ namespace StateObserver
 		// Apply hooked logic fist
 		const auto IsRacing = AsFunction<bool __thiscall (address)>(0x409500);
 
+		// Only catches race-status changes the Heat-level observer didn't already apply
 		if (Globals::playerPerpVehicle and (playerIsRacing != IsRacing(Globals::playerPerpVehicle)))
 		{
 			playerIsRacing = (not playerIsRacing);